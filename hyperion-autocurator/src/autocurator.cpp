@@ -47,13 +47,33 @@ try {
 	// Path for files
 	std::string strFilePath;
 
-	// Output CSV file
+	// File containing a list of files ("-" for standard input)
+	std::string strFileList;
+
+	// Output XML file
 	std::string strOutputFile;
 
+	// Output CSV file
+	std::string strOutputCSVFile;
+
+	// Existing CSV index to append to
+	std::string strAppendFile;
+
+	// Number of threads used for indexing
+	int nThreads;
+
+	// Cache file
+	std::string strCacheFile;
+
 	// Parse the command line
 	BeginCommandLine()
    	CommandLineString(strFilePath, "files", "");
+	CommandLineString(strFileList, "file_list", "");
 	CommandLineString(strOutputFile, "out", "");
+	CommandLineString(strOutputCSVFile, "out_csv", "");
+	CommandLineString(strAppendFile, "append", "");
+	CommandLineInt(nThreads, "threads", 1);
+	CommandLineString(strCacheFile, "cache", "");
 
 	ParseCommandLine(argc, argv);
 	EndCommandLine(argv)
@@ -61,22 +81,82 @@ try {
 	// Create a new FileListObject
 	AnnounceStartBlock("Creating FileListObject");
 	FileListObject objFileList("file_list");
+	objFileList.SetThreadCount(nThreads);
 	AnnounceEndBlock("Done");
 
-	// Populate from search string
-	AnnounceStartBlock("Populating FileListObject\n");
-	std::string strError = objFileList.PopulateFromSearchString(strFilePath);
-	if (strError != "") {
-		std::cout << strError << std::endl;
-		return (-1);
+	// Load the cache
+	FileSummaryCache cache;
+	if (strCacheFile != "") {
+		AnnounceStartBlock("Loading cache");
+		std::string strError =
+			cache.Read(strCacheFile, objFileList.GetRecordDimName());
+		if (strError != "") {
+			Announce("WARNING: %s", strError.c_str());
+		}
+		objFileList.SetFileSummaryCache(&cache);
+		AnnounceEndBlock("Done");
 	}
-	AnnounceEndBlock("Done");
-/*
+
+	// Load existing index
+	std::string strError;
+	if (strAppendFile != "") {
+		AnnounceStartBlock("Loading index from CSV file\n");
+		strError = objFileList.LoadTimeVariableIndexCSV(strAppendFile);
+		if (strError != "") {
+			std::cout << strError << std::endl;
+			return (-1);
+		}
+		AnnounceEndBlock("Done");
+	}
+
+	// Populate from file list
+	if (strFileList != "") {
+		AnnounceStartBlock("Populating FileListObject from file list\n");
+		strError = objFileList.PopulateFromFileList(strFileList);
+		if (strError != "") {
+			std::cout << strError << std::endl;
+			return (-1);
+		}
+		AnnounceEndBlock("Done");
+	}
+
+	// Populate from search string (an existing index or a file list
+	// may be used on its own)
+	if ((strFilePath != "") ||
+	    ((strFileList == "") && (strAppendFile == ""))
+	) {
+		AnnounceStartBlock("Populating FileListObject\n");
+		strError = objFileList.PopulateFromSearchString(strFilePath);
+		if (strError != "") {
+			std::cout << strError << std::endl;
+			return (-1);
+		}
+		AnnounceEndBlock("Done");
+	}
+
+	// Update the cache (all summaries are gathered on rank 0)
+	int nRank = 0;
+#if defined(HYPERION_MPIOMP)
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+#endif
+	if ((strCacheFile != "") && (nRank == 0)) {
+		AnnounceStartBlock("Writing cache");
+		Announce("%lu files unchanged, %lu files scanned",
+			cache.GetHitCount(), cache.GetMissCount());
+		strError = cache.Write(strCacheFile);
+		if (strError != "") {
+			Announce("WARNING: %s", strError.c_str());
+		}
+		AnnounceEndBlock("Done");
+	}
+
 	// Output to CSV file
-	AnnounceStartBlock("Output to CSV file\n");
-	objFileList.OutputTimeVariableIndexCSV(strOutputFile);
-	AnnounceEndBlock("Done");
-*/
+	if (strOutputCSVFile != "") {
+		AnnounceStartBlock("Output to CSV file\n");
+		objFileList.OutputTimeVariableIndexCSV(strOutputCSVFile);
+		AnnounceEndBlock("Done");
+	}
+
 	// Output to XML file
 	AnnounceStartBlock("Output to XML file\n");
 	objFileList.OutputTimeVariableIndexXML(strOutputFile);
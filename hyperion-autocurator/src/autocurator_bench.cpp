@@ -0,0 +1,341 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    autocurator_bench.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "CommandLine.h"
+#include "Announce.h"
+#include "Exception.h"
+#include "FileSearch.h"
+#include "FileSummary.h"
+#include "NetCDFUtilities.h"
+#include "TimeObj.h"
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include <sys/resource.h>
+
+#include "netcdfcpp.h"
+
+#if defined(HYPERION_MPIOMP)
+#include <mpi.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Wall clock time and resource usage at a point in time.
+///	</summary>
+class BenchmarkSample {
+
+public:
+	///	<summary>
+	///		Record the current time and resource usage.
+	///	</summary>
+	void Now() {
+		m_time = std::chrono::steady_clock::now();
+		getrusage(RUSAGE_SELF, &m_rusage);
+	}
+
+public:
+	///	<summary>
+	///		Wall clock time.
+	///	</summary>
+	std::chrono::steady_clock::time_point m_time;
+
+	///	<summary>
+	///		Resource usage.
+	///	</summary>
+	struct rusage m_rusage;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Report the cost of nOperations operations between two samples.
+///	</summary>
+void AnnounceBenchmark(
+	const char * szName,
+	size_t nOperations,
+	const BenchmarkSample & sampleBegin,
+	const BenchmarkSample & sampleEnd
+) {
+	double dSeconds =
+		std::chrono::duration<double>(
+			sampleEnd.m_time - sampleBegin.m_time).count();
+
+	const struct rusage & ru0 = sampleBegin.m_rusage;
+	const struct rusage & ru1 = sampleEnd.m_rusage;
+
+	double dOperations = static_cast<double>((nOperations == 0)?(1):(nOperations));
+
+	Announce("%-12s %8lu ops %10.3f s %12.3f us/op",
+		szName,
+		nOperations,
+		dSeconds,
+		1.0e6 * dSeconds / dOperations);
+	Announce("%-12s block in %.2f/op, minor faults %.2f/op, major faults %.2f/op",
+		"",
+		static_cast<double>(ru1.ru_inblock - ru0.ru_inblock) / dOperations,
+		static_cast<double>(ru1.ru_minflt - ru0.ru_minflt) / dOperations,
+		static_cast<double>(ru1.ru_majflt - ru0.ru_majflt) / dOperations);
+	Announce("%-12s context switches %.2f/op, max RSS %ld KiB",
+		"",
+		static_cast<double>(
+			(ru1.ru_nvcsw - ru0.ru_nvcsw) + (ru1.ru_nivcsw - ru0.ru_nivcsw))
+			/ dOperations,
+		ru1.ru_maxrss);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Open and close each file with the given NetCDF open mode.
+///	</summary>
+void BenchmarkOpen(
+	const char * szName,
+	const std::vector<std::string> & vecFiles,
+	NetCDFOpenMode eOpenMode,
+	int nRepeat
+) {
+	BenchmarkSample sampleBegin;
+	BenchmarkSample sampleEnd;
+
+	size_t nFailures = 0;
+
+	sampleBegin.Now();
+	for (int r = 0; r < nRepeat; r++) {
+		for (size_t f = 0; f < vecFiles.size(); f++) {
+			size_t sBufferSize = SetNetCDFOpenMode(eOpenMode);
+			NcFile ncFile(vecFiles[f].c_str(), NcFile::ReadOnly, &sBufferSize);
+			if (!ncFile.is_valid()) {
+				nFailures++;
+			}
+		}
+	}
+	sampleEnd.Now();
+
+	SetNetCDFOpenMode(NetCDFOpenDefault);
+
+	AnnounceBenchmark(szName, vecFiles.size() * nRepeat, sampleBegin, sampleEnd);
+	if (nFailures != 0) {
+		Announce("WARNING: %lu files could not be opened", nFailures);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Build the FileSummary of each file.
+///	</summary>
+void BenchmarkFileSummary(
+	const char * szName,
+	const std::vector<std::string> & vecFiles,
+	const std::string & strRecordDimName,
+	int nRepeat
+) {
+	BenchmarkSample sampleBegin;
+	BenchmarkSample sampleEnd;
+
+	size_t nFailures = 0;
+
+	sampleBegin.Now();
+	for (int r = 0; r < nRepeat; r++) {
+		for (size_t f = 0; f < vecFiles.size(); f++) {
+			FileSummary filesum;
+			filesum.FromFile(vecFiles[f], strRecordDimName);
+			if (filesum.m_strError != "") {
+				nFailures++;
+			}
+		}
+	}
+	sampleEnd.Now();
+
+	AnnounceBenchmark(szName, vecFiles.size() * nRepeat, sampleBegin, sampleEnd);
+	if (nFailures != 0) {
+		Announce("WARNING: %lu files could not be summarized", nFailures);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Decode a CF time axis of nTimeSteps 6-hourly values, one element
+///		at a time and as a batch.
+///	</summary>
+void BenchmarkTimeDecode(
+	int nTimeSteps,
+	int nRepeat
+) {
+	const std::string strTimeUnits("days since 1850-01-01 00:00:00");
+	const Time::CalendarType eCalendar = Time::CalendarNoLeap;
+
+	std::vector<double> dOffsets(nTimeSteps);
+	for (int t = 0; t < nTimeSteps; t++) {
+		dOffsets[t] = 60225.0 + 0.25 * static_cast<double>(t);
+	}
+
+	BenchmarkSample sampleBegin;
+	BenchmarkSample sampleEnd;
+
+	// One element at a time
+	std::vector<Time> vecTimesElement(nTimeSteps, Time(eCalendar));
+
+	sampleBegin.Now();
+	for (int r = 0; r < nRepeat; r++) {
+		for (int t = 0; t < nTimeSteps; t++) {
+			vecTimesElement[t] = Time(eCalendar);
+			vecTimesElement[t].FromCFCompliantUnitsOffsetDouble(
+				strTimeUnits, dOffsets[t]);
+		}
+	}
+	sampleEnd.Now();
+
+	AnnounceBenchmark("element", nTimeSteps * nRepeat, sampleBegin, sampleEnd);
+
+	// Batch
+	std::vector<Time> vecTimesBatch;
+
+	sampleBegin.Now();
+	for (int r = 0; r < nRepeat; r++) {
+		Time::FromCFCompliantUnitsOffsets(
+			strTimeUnits, eCalendar, dOffsets, vecTimesBatch);
+	}
+	sampleEnd.Now();
+
+	AnnounceBenchmark("batch", nTimeSteps * nRepeat, sampleBegin, sampleEnd);
+
+	// Verify
+	for (int t = 0; t < nTimeSteps; t++) {
+		if (vecTimesBatch[t] != vecTimesElement[t]) {
+			_EXCEPTION3("Batch decoding mismatch at %i (%s / %s)",
+				t,
+				vecTimesBatch[t].ToString().c_str(),
+				vecTimesElement[t].ToString().c_str());
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv) {
+
+#if defined(HYPERION_MPIOMP)
+	// Initialize MPI
+	MPI_Init(&argc, &argv);
+#endif
+
+	// Turn off fatal errors in NetCDF
+	NcError error(NcError::silent_nonfatal);
+
+try {
+
+	// Set Announce to only output on head node
+	AnnounceOnlyOutputOnRankZero();
+
+	// Path for files
+	std::string strFilePath;
+
+	// Name of the record dimension
+	std::string strRecordDimName;
+
+	// Number of times each benchmark is repeated
+	int nRepeat;
+
+	// Benchmarks to run
+	std::string strBenchmarks;
+
+	// Number of time steps decoded by the time benchmark
+	int nTimeSteps;
+
+	// Parse the command line
+	BeginCommandLine()
+	CommandLineString(strFilePath, "files", "");
+	CommandLineString(strRecordDimName, "recdim", "time");
+	CommandLineInt(nRepeat, "repeat", 1);
+	CommandLineStringD(strBenchmarks, "bench", "open,summary,time", "[open,summary,time]");
+	CommandLineInt(nTimeSteps, "time_steps", 1460);
+
+	ParseCommandLine(argc, argv);
+	EndCommandLine(argv)
+
+	if (nRepeat < 1) {
+		_EXCEPTIONT("--repeat must be positive");
+	}
+	if (nTimeSteps < 1) {
+		_EXCEPTIONT("--time_steps must be positive");
+	}
+
+	AnnounceBanner();
+
+	// Find files
+	std::vector<std::string> vecFiles;
+	if (strFilePath != "") {
+		AnnounceStartBlock("Finding files");
+		std::string strBaseDir;
+		std::string strError =
+			FindFilesFromSearchString(strFilePath, 1, strBaseDir, vecFiles);
+		if (strError != "") {
+			_EXCEPTIONT(strError.c_str());
+		}
+		Announce("%lu files found", vecFiles.size());
+		AnnounceEndBlock("Done");
+	}
+
+	// Open and close each file; the metadata scan runs first so the
+	// maximum RSS it reports is not inflated by the default mode.  The
+	// file benchmarks are skipped if no files are given.
+	if ((strBenchmarks.find("open") != std::string::npos) &&
+	    (vecFiles.size() != 0)
+	) {
+		AnnounceStartBlock("NcFile open and close");
+		BenchmarkOpen("scan", vecFiles, NetCDFOpenMetadataScan, nRepeat);
+		BenchmarkOpen("default", vecFiles, NetCDFOpenDefault, nRepeat);
+		AnnounceEndBlock("Done");
+	}
+
+	// Build a FileSummary of each file
+	if ((strBenchmarks.find("summary") != std::string::npos) &&
+	    (vecFiles.size() != 0)
+	) {
+		AnnounceStartBlock("FileSummary");
+		BenchmarkFileSummary("summary", vecFiles, strRecordDimName, nRepeat);
+		AnnounceEndBlock("Done");
+	}
+
+	// Decode a time axis
+	if (strBenchmarks.find("time") != std::string::npos) {
+		AnnounceStartBlock("CF time decoding");
+		Announce("%i time steps", nTimeSteps);
+		BenchmarkTimeDecode(nTimeSteps, nRepeat);
+		AnnounceEndBlock("Done");
+	}
+
+	AnnounceBanner();
+
+} catch(Exception & e) {
+	Announce(e.ToString().c_str());
+} catch(...) {
+}
+
+#if defined(HYPERION_MPIOMP)
+	// Deinitialize MPI
+	MPI_Finalize();
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
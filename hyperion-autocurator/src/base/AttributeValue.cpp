@@ -0,0 +1,321 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    AttributeValue.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "AttributeValue.h"
+#include "StringPool.h"
+#include "BinaryStream.h"
+#include "Exception.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Load an element of type T from possibly unaligned storage.
+///	</summary>
+template <typename T>
+static T LoadElement(
+	const unsigned char * p,
+	size_t i
+) {
+	T value;
+	memcpy(&value, p + i * sizeof(T), sizeof(T));
+	return value;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Append a floating point number to a string using the fewest
+///		significant digits, between six (the std::ostream default) and
+///		nMaxDigits, that read back as the same value.
+///	</summary>
+static void AppendFloatingPoint(
+	std::string & str,
+	double dValue,
+	bool fSinglePrecision
+) {
+	const int nMaxDigits = (fSinglePrecision)?(9):(17);
+
+	char szValue[64];
+	for (int p = 6; p <= nMaxDigits; p++) {
+		snprintf(szValue, sizeof(szValue), "%.*g", p, dValue);
+		if (fSinglePrecision) {
+			if (strtof(szValue, NULL) == static_cast<float>(dValue)) {
+				break;
+			}
+		} else {
+			if (strtod(szValue, NULL) == dValue) {
+				break;
+			}
+		}
+	}
+	str += szValue;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// AttributeValue
+///////////////////////////////////////////////////////////////////////////////
+
+size_t AttributeValue::GetTypeSize(
+	NcType nctype
+) {
+	switch (nctype) {
+		case ncByte:
+		case ncChar:
+		case ncUByte:
+			return 1;
+		case ncShort:
+		case ncUShort:
+			return 2;
+		case ncInt:
+		case ncUInt:
+		case ncFloat:
+			return 4;
+		case ncDouble:
+		case ncInt64:
+		case ncUInt64:
+			return 8;
+		default:
+			return 0;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+AttributeValue::AttributeValue() :
+	m_nctype(ncNoType),
+	m_sCount(0)
+{
+	memset(m_bufInline, 0, InlineCapacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+AttributeValue::AttributeValue(
+	const std::string & strText
+) {
+	Set(ncChar, strText.length(), strText.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AttributeValue::Set(
+	NcType nctype,
+	size_t sCount,
+	const void * pData
+) {
+	size_t sTypeSize = GetTypeSize(nctype);
+	if ((sTypeSize == 0) && (sCount != 0)) {
+		_EXCEPTION1("Unsupported attribute type %i", static_cast<int>(nctype));
+	}
+	if (sCount > static_cast<size_t>(UINT32_MAX)) {
+		_EXCEPTIONT("Attribute has too many elements");
+	}
+
+	// Character data is kept up to the first NUL, as it is formatted
+	if (nctype == ncChar) {
+		const char * sz = static_cast<const char *>(pData);
+		size_t sLength = 0;
+		while ((sLength < sCount) && (sz[sLength] != '\0')) {
+			sLength++;
+		}
+		sCount = sLength;
+	}
+
+	m_nctype = nctype;
+	m_sCount = static_cast<uint32_t>(sCount);
+
+	size_t sBytes = sTypeSize * sCount;
+	memset(m_bufInline, 0, InlineCapacity);
+	if (sBytes <= InlineCapacity) {
+		if (sBytes != 0) {
+			memcpy(m_bufInline, pData, sBytes);
+		}
+		m_pstrLong.reset();
+	} else {
+		m_pstrLong =
+			std::make_shared<const std::string>(
+				static_cast<const char *>(pData), sBytes);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+const void * AttributeValue::GetData() const {
+	if (IsInline()) {
+		return m_bufInline;
+	} else {
+		return m_pstrLong->c_str();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string AttributeValue::ToString() const {
+	const unsigned char * p =
+		static_cast<const unsigned char *>(GetData());
+
+	if (m_nctype == ncChar) {
+		return std::string(reinterpret_cast<const char *>(p), m_sCount);
+	}
+
+	std::string str;
+	char szValue[32];
+	for (size_t i = 0; i < m_sCount; i++) {
+		if (i != 0) {
+			str += ", ";
+		}
+
+		szValue[0] = '\0';
+		switch (m_nctype) {
+			case ncByte:
+				snprintf(szValue, sizeof(szValue), "%d",
+					static_cast<int>(LoadElement<signed char>(p, i)));
+				break;
+			case ncUByte:
+				snprintf(szValue, sizeof(szValue), "%u",
+					static_cast<unsigned int>(LoadElement<unsigned char>(p, i)));
+				break;
+			case ncShort:
+				snprintf(szValue, sizeof(szValue), "%d",
+					static_cast<int>(LoadElement<short>(p, i)));
+				break;
+			case ncUShort:
+				snprintf(szValue, sizeof(szValue), "%u",
+					static_cast<unsigned int>(LoadElement<unsigned short>(p, i)));
+				break;
+			case ncInt:
+				snprintf(szValue, sizeof(szValue), "%d",
+					LoadElement<int>(p, i));
+				break;
+			case ncUInt:
+				snprintf(szValue, sizeof(szValue), "%u",
+					LoadElement<unsigned int>(p, i));
+				break;
+			case ncInt64:
+				snprintf(szValue, sizeof(szValue), "%lld",
+					LoadElement<long long>(p, i));
+				break;
+			case ncUInt64:
+				snprintf(szValue, sizeof(szValue), "%llu",
+					LoadElement<unsigned long long>(p, i));
+				break;
+			case ncFloat:
+				AppendFloatingPoint(str,
+					static_cast<double>(LoadElement<float>(p, i)), true);
+				break;
+			case ncDouble:
+				AppendFloatingPoint(str,
+					LoadElement<double>(p, i), false);
+				break;
+			default:
+				break;
+		}
+		str += szValue;
+	}
+	return str;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t AttributeValue::GetHash() const {
+
+	// FNV-1a over the type, count and elements
+	uint64_t uHash = 0xcbf29ce484222325ULL;
+	uHash = (uHash ^ static_cast<uint64_t>(m_nctype)) * 0x100000001b3ULL;
+	uHash = (uHash ^ static_cast<uint64_t>(m_sCount)) * 0x100000001b3ULL;
+
+	const unsigned char * p =
+		static_cast<const unsigned char *>(GetData());
+	size_t sBytes = GetSize();
+	for (size_t i = 0; i < sBytes; i++) {
+		uHash = (uHash ^ static_cast<uint64_t>(p[i])) * 0x100000001b3ULL;
+	}
+	return static_cast<size_t>(uHash);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AttributeValue::Share() {
+	if (IsInline()) {
+		return;
+	}
+
+	// Pooled strings are never freed, so the handle does not own them
+	m_pstrLong =
+		std::shared_ptr<const std::string>(
+			std::shared_ptr<const std::string>(),
+			StringPool::GetGlobal().Intern(*m_pstrLong));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AttributeValue::Serialize(
+	std::ostream & os
+) const {
+	WriteBinary<int32_t>(os, static_cast<int32_t>(m_nctype));
+	WriteBinary<uint64_t>(os, static_cast<uint64_t>(m_sCount));
+	os.write(static_cast<const char *>(GetData()), GetSize());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool AttributeValue::Deserialize(
+	std::istream & is
+) {
+	int32_t iNcType;
+	uint64_t sCount;
+
+	if (!ReadBinary<int32_t>(is, iNcType)) return false;
+	if (!ReadBinary<uint64_t>(is, sCount)) return false;
+
+	NcType nctype = static_cast<NcType>(iNcType);
+	size_t sTypeSize = GetTypeSize(nctype);
+	if ((sTypeSize == 0) && (sCount != 0)) return false;
+	if (sCount > MaximumSerializedLength) return false;
+
+	std::string strData(static_cast<size_t>(sCount) * sTypeSize, '\0');
+	if (strData.length() != 0) {
+		is.read(&(strData[0]), strData.length());
+		if (is.fail()) return false;
+	}
+
+	Set(nctype, static_cast<size_t>(sCount), strData.c_str());
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool AttributeValue::operator==(
+	const AttributeValue & value
+) const {
+	if ((m_nctype != value.m_nctype) || (m_sCount != value.m_sCount)) {
+		return false;
+	}
+	if (IsInline()) {
+		return (memcmp(m_bufInline, value.m_bufInline, InlineCapacity) == 0);
+	}
+	return (
+		(m_pstrLong == value.m_pstrLong) ||
+		((*m_pstrLong) == (*value.m_pstrLong)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    AttributeValue.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _ATTRIBUTEVALUE_H_
+#define _ATTRIBUTEVALUE_H_
+
+#include "netcdfcpp.h"
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		The typed value of a NetCDF attribute: a type, a number of
+///		elements and the elements in native byte order.  Values of up to
+///		InlineCapacity bytes are stored in the object itself; longer
+///		values are stored in a reference counted buffer that is shared
+///		by copies of the object and freed with the last copy.
+///	</summary>
+class AttributeValue {
+
+public:
+	///	<summary>
+	///		Maximum size in bytes of a value stored in the object itself.
+	///	</summary>
+	static const size_t InlineCapacity = 16;
+
+	///	<summary>
+	///		Get the size in bytes of one element of the given type, or
+	///		zero if attributes of this type are not supported.
+	///	</summary>
+	static size_t GetTypeSize(
+		NcType nctype
+	);
+
+public:
+	///	<summary>
+	///		Constructor (no value).
+	///	</summary>
+	AttributeValue();
+
+	///	<summary>
+	///		Constructor (text value).
+	///	</summary>
+	explicit AttributeValue(
+		const std::string & strText
+	);
+
+public:
+	///	<summary>
+	///		Set the value from sCount elements of the given type, stored
+	///		in native byte order at pData.  Character data is truncated at
+	///		the first NUL.
+	///	</summary>
+	void Set(
+		NcType nctype,
+		size_t sCount,
+		const void * pData
+	);
+
+	///	<summary>
+	///		Get the type of the value.
+	///	</summary>
+	NcType GetType() const {
+		return m_nctype;
+	}
+
+	///	<summary>
+	///		Get the number of elements in the value.
+	///	</summary>
+	size_t GetCount() const {
+		return static_cast<size_t>(m_sCount);
+	}
+
+	///	<summary>
+	///		Get the size of the value in bytes.
+	///	</summary>
+	size_t GetSize() const {
+		return GetTypeSize(m_nctype) * static_cast<size_t>(m_sCount);
+	}
+
+	///	<summary>
+	///		Get the elements of the value in native byte order.
+	///	</summary>
+	const void * GetData() const;
+
+	///	<summary>
+	///		Format the value.  Numeric elements are separated by ", " and
+	///		floating point elements are written with the fewest significant
+	///		digits (but no fewer than six) that read back as the same value.
+	///	</summary>
+	std::string ToString() const;
+
+	///	<summary>
+	///		Get a hash of the value.  Equal values have equal hashes.
+	///	</summary>
+	size_t GetHash() const;
+
+	///	<summary>
+	///		Replace the buffer of a long value with its copy in the global
+	///		StringPool, so equal values kept in the index share one copy
+	///		and compare by address.  Only values that are kept for the
+	///		lifetime of the index should be shared.
+	///	</summary>
+	void Share();
+
+public:
+	///	<summary>
+	///		Write to a binary stream.
+	///	</summary>
+	void Serialize(
+		std::ostream & os
+	) const;
+
+	///	<summary>
+	///		Read from a binary stream.
+	///	</summary>
+	bool Deserialize(
+		std::istream & is
+	);
+
+public:
+	///	<summary>
+	///		Equality operator.
+	///	</summary>
+	bool operator==(const AttributeValue & value) const;
+
+	///	<summary>
+	///		Inequality operator.
+	///	</summary>
+	bool operator!=(const AttributeValue & value) const {
+		return !((*this) == value);
+	}
+
+protected:
+	///	<summary>
+	///		Check if the value is stored in the object itself.
+	///	</summary>
+	bool IsInline() const {
+		return (GetSize() <= InlineCapacity);
+	}
+
+protected:
+	///	<summary>
+	///		Type of the value.
+	///	</summary>
+	NcType m_nctype;
+
+	///	<summary>
+	///		Number of elements in the value.
+	///	</summary>
+	uint32_t m_sCount;
+
+	///	<summary>
+	///		Elements of an inline value, zero padded.
+	///	</summary>
+	unsigned char m_bufInline[InlineCapacity];
+
+	///	<summary>
+	///		Elements of a long value.
+	///	</summary>
+	std::shared_ptr<const std::string> m_pstrLong;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
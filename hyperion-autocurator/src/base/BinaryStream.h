@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    BinaryStream.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _BINARYSTREAM_H_
+#define _BINARYSTREAM_H_
+
+#include "StringPool.h"
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions for reading and writing native-endian binary data.
+// The ReadBinary functions return false on a short read or if a length
+// prefix exceeds MaximumSerializedLength.
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Maximum length of a string or array read from a binary stream.
+///	</summary>
+static const uint64_t MaximumSerializedLength = (1 << 30);
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+inline void WriteBinary(std::ostream & os, const T & value) {
+	os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+inline bool ReadBinary(std::istream & is, T & value) {
+	is.read(reinterpret_cast<char *>(&value), sizeof(T));
+	return (!is.fail());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+inline void WriteBinary(std::ostream & os, const std::string & str) {
+	WriteBinary<uint64_t>(os, str.length());
+	os.write(str.c_str(), str.length());
+}
+
+inline bool ReadBinary(std::istream & is, std::string & str) {
+	uint64_t sLength;
+	if (!ReadBinary<uint64_t>(is, sLength)) {
+		return false;
+	}
+	if (sLength > MaximumSerializedLength) {
+		return false;
+	}
+	str.resize(sLength);
+	if (sLength != 0) {
+		is.read(&(str[0]), sLength);
+	}
+	return (!is.fail());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+inline void WriteBinary(std::ostream & os, const std::vector<T> & vec) {
+	WriteBinary<uint64_t>(os, vec.size());
+	if (vec.size() != 0) {
+		os.write(
+			reinterpret_cast<const char *>(&(vec[0])),
+			vec.size() * sizeof(T));
+	}
+}
+
+template <typename T>
+inline bool ReadBinary(std::istream & is, std::vector<T> & vec) {
+	uint64_t sSize;
+	if (!ReadBinary<uint64_t>(is, sSize)) {
+		return false;
+	}
+	if (sSize > MaximumSerializedLength / sizeof(T)) {
+		return false;
+	}
+	vec.resize(sSize);
+	if (sSize != 0) {
+		is.read(reinterpret_cast<char *>(&(vec[0])), sSize * sizeof(T));
+	}
+	return (!is.fail());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+inline void WriteBinary(
+	std::ostream & os,
+	const std::vector<std::string> & vec
+) {
+	WriteBinary<uint64_t>(os, vec.size());
+	for (size_t i = 0; i < vec.size(); i++) {
+		WriteBinary(os, vec[i]);
+	}
+}
+
+inline bool ReadBinary(
+	std::istream & is,
+	std::vector<std::string> & vec
+) {
+	uint64_t sSize;
+	if (!ReadBinary<uint64_t>(is, sSize)) {
+		return false;
+	}
+	if (sSize > MaximumSerializedLength) {
+		return false;
+	}
+	vec.resize(sSize);
+	for (size_t i = 0; i < vec.size(); i++) {
+		if (!ReadBinary(is, vec[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+inline void WriteBinary(std::ostream & os, const InternedString & istr) {
+	WriteBinary(os, istr.str());
+}
+
+inline bool ReadBinary(std::istream & is, InternedString & istr) {
+	std::string str;
+	if (!ReadBinary(is, str)) {
+		return false;
+	}
+	istr = InternedString(str);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+inline void WriteBinary(
+	std::ostream & os,
+	const std::vector<InternedString> & vec
+) {
+	WriteBinary<uint64_t>(os, vec.size());
+	for (size_t i = 0; i < vec.size(); i++) {
+		WriteBinary(os, vec[i]);
+	}
+}
+
+inline bool ReadBinary(
+	std::istream & is,
+	std::vector<InternedString> & vec
+) {
+	uint64_t sSize;
+	if (!ReadBinary<uint64_t>(is, sSize)) {
+		return false;
+	}
+	if (sSize > MaximumSerializedLength) {
+		return false;
+	}
+	vec.resize(sSize);
+	for (size_t i = 0; i < vec.size(); i++) {
+		if (!ReadBinary(is, vec[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+#endif
+
@@ -0,0 +1,621 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ClassicNetCDFReader.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "ClassicNetCDFReader.h"
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Number of header bytes read when the file is opened.
+///	</summary>
+static const uint64_t ClassicHeaderInitialRead = 32768;
+
+///	<summary>
+///		Maximum span of record data read with a single pread().
+///	</summary>
+static const uint64_t ClassicMaximumRecordSpan = (4 << 20);
+
+///	<summary>
+///		Header list tags.
+///	</summary>
+static const uint32_t ClassicTagDimension = 0x0A;
+static const uint32_t ClassicTagVariable = 0x0B;
+static const uint32_t ClassicTagAttribute = 0x0C;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Size of one element of the given type, or 0 if the type is not
+///		supported.  Of the unsigned CDF-5 types the netcdf-cxx wrapper
+///		only reads ncUInt64, so ncUByte, ncUShort and ncUInt are rejected
+///		here as well.  The 64-bit types are only valid in CDF-5.
+///	</summary>
+static size_t ClassicTypeSize(
+	uint32_t iType
+) {
+	switch (iType) {
+		case ncByte:
+		case ncChar:
+			return 1;
+		case ncShort:
+			return 2;
+		case ncInt:
+		case ncFloat:
+			return 4;
+		case ncDouble:
+		case ncInt64:
+		case ncUInt64:
+			return 8;
+		default:
+			return 0;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Decode a big-endian unsigned integer.
+///	</summary>
+static uint64_t DecodeBigEndian(
+	const unsigned char * p,
+	size_t sBytes
+) {
+	uint64_t iValue = 0;
+	for (size_t i = 0; i < sBytes; i++) {
+		iValue = (iValue << 8) | static_cast<uint64_t>(p[i]);
+	}
+	return iValue;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Decode the big-endian elements of an attribute into a typed value.
+///	</summary>
+static void DecodeAttributeValue(
+	uint32_t iType,
+	const unsigned char * p,
+	uint64_t sElements,
+	std::vector<unsigned char> & vecBuffer,
+	AttributeValue & value
+) {
+	NcType nctype = static_cast<NcType>(iType);
+	size_t sTypeSize = ClassicTypeSize(iType);
+
+	if ((sTypeSize == 1) || (sElements == 0)) {
+		value.Set(nctype, sElements, p);
+		return;
+	}
+
+	vecBuffer.resize(sElements * sTypeSize);
+	for (uint64_t i = 0; i < sElements; i++) {
+		uint64_t iBits = DecodeBigEndian(p + i * sTypeSize, sTypeSize);
+		unsigned char * pElement = &(vecBuffer[i * sTypeSize]);
+		if (sTypeSize == 2) {
+			uint16_t iBits16 = static_cast<uint16_t>(iBits);
+			memcpy(pElement, &iBits16, 2);
+		} else if (sTypeSize == 4) {
+			uint32_t iBits32 = static_cast<uint32_t>(iBits);
+			memcpy(pElement, &iBits32, 4);
+		} else {
+			memcpy(pElement, &iBits, 8);
+		}
+	}
+	value.Set(nctype, sElements, &(vecBuffer[0]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+ClassicNetCDFReader::~ClassicNetCDFReader() {
+	if (m_fd != (-1)) {
+		close(m_fd);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::Require(
+	uint64_t sBytes
+) {
+	if (sBytes > m_sFileSize - m_sPos) {
+		return false;
+	}
+	if (m_sPos + sBytes <= m_vecHeader.size()) {
+		return true;
+	}
+
+	// Grow the buffer geometrically so long headers need few reads
+	uint64_t sOldSize = m_vecHeader.size();
+	uint64_t sNewSize = 2 * sOldSize;
+	if (sNewSize < m_sPos + sBytes) {
+		sNewSize = m_sPos + sBytes;
+	}
+	if (sNewSize > m_sFileSize) {
+		sNewSize = m_sFileSize;
+	}
+
+	m_vecHeader.resize(sNewSize);
+	uint64_t sRead = sOldSize;
+	while (sRead < sNewSize) {
+		ssize_t sResult =
+			pread(m_fd, &(m_vecHeader[sRead]), sNewSize - sRead, sRead);
+		if (sResult <= 0) {
+			m_vecHeader.resize(sRead);
+			return false;
+		}
+		sRead += static_cast<uint64_t>(sResult);
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::GetUInt32(
+	uint32_t & iValue
+) {
+	if (!Require(4)) {
+		return false;
+	}
+	iValue = static_cast<uint32_t>(DecodeBigEndian(&(m_vecHeader[m_sPos]), 4));
+	m_sPos += 4;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::GetCount(
+	uint64_t & sValue
+) {
+	size_t sBytes = (m_iVersion == 5)?(8):(4);
+	if (!Require(sBytes)) {
+		return false;
+	}
+	sValue = DecodeBigEndian(&(m_vecHeader[m_sPos]), sBytes);
+	m_sPos += sBytes;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::GetOffset(
+	uint64_t & sValue
+) {
+	size_t sBytes = (m_iVersion == 1)?(4):(8);
+	if (!Require(sBytes)) {
+		return false;
+	}
+	sValue = DecodeBigEndian(&(m_vecHeader[m_sPos]), sBytes);
+	m_sPos += sBytes;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::GetName(
+	std::string & strName
+) {
+	uint64_t sLength;
+	if (!GetCount(sLength)) {
+		return false;
+	}
+	if (sLength > m_sFileSize) {
+		return false;
+	}
+	uint64_t sPadded = (sLength + 3) & ~static_cast<uint64_t>(3);
+	if (!Require(sPadded)) {
+		return false;
+	}
+	strName.assign(
+		reinterpret_cast<const char *>(&(m_vecHeader[m_sPos])), sLength);
+	m_sPos += sPadded;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::GetListHeader(
+	uint32_t iExpectedTag,
+	uint64_t & sElements
+) {
+	uint32_t iTag;
+	if (!GetUInt32(iTag)) {
+		return false;
+	}
+	if (!GetCount(sElements)) {
+		return false;
+	}
+
+	// An absent list has a zero tag and zero elements
+	if (iTag == 0) {
+		return (sElements == 0);
+	}
+	if (iTag != iExpectedTag) {
+		return false;
+	}
+
+	// Every element occupies at least four bytes of header
+	return (sElements <= (m_sFileSize - m_sPos) / 4);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::GetAttributeList(
+	AttributeList & vecAttributes
+) {
+	uint64_t sAttributes;
+	if (!GetListHeader(ClassicTagAttribute, sAttributes)) {
+		return false;
+	}
+
+	std::string strAttName;
+	std::vector<unsigned char> vecBuffer;
+
+	vecAttributes.resize(sAttributes);
+	for (uint64_t a = 0; a < sAttributes; a++) {
+		uint32_t iType;
+		uint64_t sElements;
+
+		if (!GetName(strAttName)) {
+			return false;
+		}
+		vecAttributes[a].first = InternedString(strAttName);
+		if (!GetUInt32(iType)) {
+			return false;
+		}
+		if (!GetCount(sElements)) {
+			return false;
+		}
+
+		size_t sTypeSize = ClassicTypeSize(iType);
+		if (sTypeSize == 0) {
+			return false;
+		}
+		if ((iType > ncDouble) && (m_iVersion != 5)) {
+			return false;
+		}
+		if (sElements > m_sFileSize / sTypeSize) {
+			return false;
+		}
+
+		uint64_t sBytes = sElements * sTypeSize;
+		uint64_t sPadded = (sBytes + 3) & ~static_cast<uint64_t>(3);
+		if (!Require(sPadded)) {
+			return false;
+		}
+
+		DecodeAttributeValue(
+			iType,
+			(sBytes == 0)?(NULL):(&(m_vecHeader[m_sPos])),
+			sElements,
+			vecBuffer,
+			vecAttributes[a].second);
+
+		m_sPos += sPadded;
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::Open(
+	const std::string & strFilename
+) {
+	m_fd = open(strFilename.c_str(), O_RDONLY);
+	if (m_fd == (-1)) {
+		return false;
+	}
+
+	struct stat statFile;
+	if (fstat(m_fd, &statFile) != 0) {
+		return false;
+	}
+	m_sFileSize = static_cast<uint64_t>(statFile.st_size);
+
+	// Read the start of the header in one request
+	m_vecHeader.reserve(ClassicHeaderInitialRead);
+	if (!Require(
+		(m_sFileSize < ClassicHeaderInitialRead)
+			?(m_sFileSize):(ClassicHeaderInitialRead))
+	) {
+		return false;
+	}
+
+	// Magic number
+	if (!Require(4)) {
+		return false;
+	}
+	if ((m_vecHeader[0] != 'C') ||
+	    (m_vecHeader[1] != 'D') ||
+	    (m_vecHeader[2] != 'F')
+	) {
+		return false;
+	}
+	m_iVersion = m_vecHeader[3];
+	if ((m_iVersion != 1) && (m_iVersion != 2) && (m_iVersion != 5)) {
+		return false;
+	}
+	m_sPos = 4;
+
+	// Number of records; files still being written are left to libnetcdf
+	uint64_t sRecords;
+	if (!GetCount(sRecords)) {
+		return false;
+	}
+	if ((m_iVersion == 5)
+		? (sRecords == static_cast<uint64_t>(-1))
+		: (sRecords == 0xFFFFFFFFu)
+	) {
+		return false;
+	}
+
+	// Dimensions
+	uint64_t sDimensions;
+	if (!GetListHeader(ClassicTagDimension, sDimensions)) {
+		return false;
+	}
+	m_vecDimensions.resize(sDimensions);
+	for (uint64_t d = 0; d < sDimensions; d++) {
+		uint64_t sSize;
+		if (!GetName(m_vecDimensions[d].m_strName)) {
+			return false;
+		}
+		if (!GetCount(sSize)) {
+			return false;
+		}
+		m_vecDimensions[d].m_fUnlimited = (sSize == 0);
+		m_vecDimensions[d].m_lSize =
+			static_cast<long>((sSize == 0)?(sRecords):(sSize));
+	}
+
+	// Global attributes
+	if (!GetAttributeList(m_vecAttributes)) {
+		return false;
+	}
+
+	// Variables
+	uint64_t sVariables;
+	if (!GetListHeader(ClassicTagVariable, sVariables)) {
+		return false;
+	}
+	m_vecVariables.resize(sVariables);
+	for (uint64_t v = 0; v < sVariables; v++) {
+		Variable & var = m_vecVariables[v];
+
+		uint64_t sVarDims;
+		if (!GetName(var.m_strName)) {
+			return false;
+		}
+		if (!GetCount(sVarDims)) {
+			return false;
+		}
+		if (sVarDims > sDimensions) {
+			return false;
+		}
+		var.m_vecDimIx.resize(sVarDims);
+		for (uint64_t d = 0; d < sVarDims; d++) {
+			uint64_t sDimIx;
+			if (!GetCount(sDimIx)) {
+				return false;
+			}
+			if (sDimIx >= sDimensions) {
+				return false;
+			}
+			var.m_vecDimIx[d] = static_cast<size_t>(sDimIx);
+		}
+
+		if (!GetAttributeList(var.m_vecAttributes)) {
+			return false;
+		}
+
+		uint32_t iType;
+		uint64_t sVarSize;
+		if (!GetUInt32(iType)) {
+			return false;
+		}
+		if (ClassicTypeSize(iType) == 0) {
+			return false;
+		}
+		if ((iType > ncDouble) && (m_iVersion != 5)) {
+			return false;
+		}
+		if (!GetCount(sVarSize)) {
+			return false;
+		}
+		if (!GetOffset(var.m_sBegin)) {
+			return false;
+		}
+
+		var.m_nctype = static_cast<NcType>(iType);
+		var.m_fRecord =
+			(sVarDims != 0) && m_vecDimensions[var.m_vecDimIx[0]].m_fUnlimited;
+	}
+
+	// Size of a record, computed as libnetcdf does (the vsize stored in
+	// the header may overflow, so it is not used)
+	uint64_t sLastRecordSize = 0;
+	uint64_t sLastRecordPadded = 0;
+	for (size_t v = 0; v < m_vecVariables.size(); v++) {
+		const Variable & var = m_vecVariables[v];
+		if (!var.m_fRecord) {
+			continue;
+		}
+		uint64_t sSize = ClassicTypeSize(var.m_nctype);
+		for (size_t d = 1; d < var.m_vecDimIx.size(); d++) {
+			sSize *= static_cast<uint64_t>(
+				m_vecDimensions[var.m_vecDimIx[d]].m_lSize);
+		}
+		sLastRecordSize = sSize;
+		sLastRecordPadded = (sSize + 3) & ~static_cast<uint64_t>(3);
+		m_sRecordSize += sLastRecordPadded;
+	}
+
+	// A single record variable is not padded
+	if ((m_sRecordSize != 0) && (m_sRecordSize == sLastRecordPadded)) {
+		m_sRecordSize = sLastRecordSize;
+	}
+
+	// The header is no longer needed
+	std::vector<unsigned char>().swap(m_vecHeader);
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int ClassicNetCDFReader::FindVariable(
+	const std::string & strName
+) const {
+	for (size_t v = 0; v < m_vecVariables.size(); v++) {
+		if (m_vecVariables[v].m_strName == strName) {
+			return static_cast<int>(v);
+		}
+	}
+	return (-1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::ReadRawValues(
+	size_t v,
+	size_t sElementSize,
+	std::vector<unsigned char> & vecData
+) const {
+	const Variable & var = m_vecVariables[v];
+	if (var.m_vecDimIx.size() != 1) {
+		return false;
+	}
+
+	uint64_t sCount =
+		static_cast<uint64_t>(m_vecDimensions[var.m_vecDimIx[0]].m_lSize);
+	if (sCount > m_sFileSize / sElementSize) {
+		return false;
+	}
+	vecData.resize(sCount * sElementSize);
+	if (sCount == 0) {
+		return true;
+	}
+
+	// Fixed-size variables are contiguous; record variables are strided
+	// by the record size and are read either as one span or per record
+	uint64_t sStride = (var.m_fRecord)?(m_sRecordSize):(sElementSize);
+	uint64_t sSpan = (sCount - 1) * sStride + sElementSize;
+
+	if ((sStride == sElementSize) || (sSpan <= ClassicMaximumRecordSpan)) {
+		std::vector<unsigned char> vecSpan;
+		unsigned char * pSpan = &(vecData[0]);
+		if (sStride != sElementSize) {
+			vecSpan.resize(sSpan);
+			pSpan = &(vecSpan[0]);
+		}
+
+		uint64_t sRead = 0;
+		while (sRead < sSpan) {
+			ssize_t sResult =
+				pread(m_fd, pSpan + sRead, sSpan - sRead, var.m_sBegin + sRead);
+			if (sResult <= 0) {
+				return false;
+			}
+			sRead += static_cast<uint64_t>(sResult);
+		}
+
+		if (sStride != sElementSize) {
+			for (uint64_t i = 0; i < sCount; i++) {
+				memcpy(
+					&(vecData[i * sElementSize]),
+					&(vecSpan[i * sStride]),
+					sElementSize);
+			}
+		}
+
+	} else {
+		for (uint64_t i = 0; i < sCount; i++) {
+			ssize_t sResult =
+				pread(m_fd,
+					&(vecData[i * sElementSize]),
+					sElementSize,
+					var.m_sBegin + i * sStride);
+			if (sResult != static_cast<ssize_t>(sElementSize)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::ReadValues(
+	size_t v,
+	std::vector<double> & vecValues
+) const {
+	const NcType nctype = m_vecVariables[v].m_nctype;
+	if ((nctype != ncInt) && (nctype != ncDouble)) {
+		return false;
+	}
+
+	const size_t sElementSize = ClassicTypeSize(nctype);
+
+	std::vector<unsigned char> vecData;
+	if (!ReadRawValues(v, sElementSize, vecData)) {
+		return false;
+	}
+
+	vecValues.resize(vecData.size() / sElementSize);
+	for (size_t i = 0; i < vecValues.size(); i++) {
+		uint64_t iBits =
+			DecodeBigEndian(&(vecData[i * sElementSize]), sElementSize);
+		if (nctype == ncInt) {
+			vecValues[i] =
+				static_cast<double>(static_cast<int32_t>(iBits));
+		} else {
+			memcpy(&(vecValues[i]), &iBits, sizeof(double));
+		}
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ClassicNetCDFReader::ReadValues(
+	size_t v,
+	std::vector<float> & vecValues
+) const {
+	if (m_vecVariables[v].m_nctype != ncFloat) {
+		return false;
+	}
+
+	std::vector<unsigned char> vecData;
+	if (!ReadRawValues(v, sizeof(float), vecData)) {
+		return false;
+	}
+
+	vecValues.resize(vecData.size() / sizeof(float));
+	for (size_t i = 0; i < vecValues.size(); i++) {
+		uint32_t iBits = static_cast<uint32_t>(
+			DecodeBigEndian(&(vecData[i * sizeof(float)]), sizeof(float)));
+		memcpy(&(vecValues[i]), &iBits, sizeof(float));
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
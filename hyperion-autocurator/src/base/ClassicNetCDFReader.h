@@ -0,0 +1,290 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ClassicNetCDFReader.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _CLASSICNETCDFREADER_H_
+#define _CLASSICNETCDFREADER_H_
+
+#include "FileSummary.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A reader for the header of netCDF classic format files (CDF-1,
+///		CDF-2 and CDF-5) which does not go through libnetcdf.  Only the
+///		header and the values of one-dimensional variables are read, using
+///		pread(), so the reader is thread-safe across instances.
+///	</summary>
+class ClassicNetCDFReader {
+
+public:
+	///	<summary>
+	///		A dimension in the file.
+	///	</summary>
+	class Dimension {
+	public:
+		///	<summary>
+		///		Dimension name.
+		///	</summary>
+		std::string m_strName;
+
+		///	<summary>
+		///		Dimension size (the number of records if unlimited).
+		///	</summary>
+		long m_lSize;
+
+		///	<summary>
+		///		Flag indicating this is the unlimited dimension.
+		///	</summary>
+		bool m_fUnlimited;
+	};
+
+	///	<summary>
+	///		A variable in the file.
+	///	</summary>
+	class Variable {
+	public:
+		///	<summary>
+		///		Variable name.
+		///	</summary>
+		std::string m_strName;
+
+		///	<summary>
+		///		Variable type.
+		///	</summary>
+		NcType m_nctype;
+
+		///	<summary>
+		///		Indices of the dimensions of this variable.
+		///	</summary>
+		std::vector<size_t> m_vecDimIx;
+
+		///	<summary>
+		///		Attributes of this variable.
+		///	</summary>
+		AttributeList m_vecAttributes;
+
+		///	<summary>
+		///		Offset of the data of this variable in the file.
+		///	</summary>
+		uint64_t m_sBegin;
+
+		///	<summary>
+		///		Flag indicating this variable is a record variable.
+		///	</summary>
+		bool m_fRecord;
+	};
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	ClassicNetCDFReader() :
+		m_fd(-1),
+		m_sFileSize(0),
+		m_iVersion(0),
+		m_sPos(0),
+		m_sRecordSize(0)
+	{ }
+
+	///	<summary>
+	///		Destructor.
+	///	</summary>
+	~ClassicNetCDFReader();
+
+private:
+	///	<summary>
+	///		Copy constructor (not implemented).
+	///	</summary>
+	ClassicNetCDFReader(const ClassicNetCDFReader &);
+
+	///	<summary>
+	///		Assignment operator (not implemented).
+	///	</summary>
+	ClassicNetCDFReader & operator=(const ClassicNetCDFReader &);
+
+public:
+	///	<summary>
+	///		Open the given file and parse its header.  Returns false if the
+	///		file is not a classic format file, or uses a feature this reader
+	///		does not support, in which case libnetcdf should be used.
+	///	</summary>
+	bool Open(
+		const std::string & strFilename
+	);
+
+	///	<summary>
+	///		Get the global attributes.
+	///	</summary>
+	const AttributeList & GetAttributes() const {
+		return m_vecAttributes;
+	}
+
+	///	<summary>
+	///		Get the dimensions, in file order.
+	///	</summary>
+	const std::vector<Dimension> & GetDimensions() const {
+		return m_vecDimensions;
+	}
+
+	///	<summary>
+	///		Get the variables, in file order.
+	///	</summary>
+	const std::vector<Variable> & GetVariables() const {
+		return m_vecVariables;
+	}
+
+	///	<summary>
+	///		Find the variable with the given name, or return (-1).
+	///	</summary>
+	int FindVariable(
+		const std::string & strName
+	) const;
+
+	///	<summary>
+	///		Read all values of a one-dimensional ncInt or ncDouble variable.
+	///		Returns false if the data could not be read.
+	///	</summary>
+	bool ReadValues(
+		size_t v,
+		std::vector<double> & vecValues
+	) const;
+
+	///	<summary>
+	///		Read all values of a one-dimensional ncFloat variable.  Returns
+	///		false if the data could not be read.
+	///	</summary>
+	bool ReadValues(
+		size_t v,
+		std::vector<float> & vecValues
+	) const;
+
+private:
+	///	<summary>
+	///		Ensure the next sBytes bytes of the header are buffered.
+	///	</summary>
+	bool Require(
+		uint64_t sBytes
+	);
+
+	///	<summary>
+	///		Read a 32-bit big-endian integer from the header.
+	///	</summary>
+	bool GetUInt32(
+		uint32_t & iValue
+	);
+
+	///	<summary>
+	///		Read a non-negative count from the header (32 bits, or 64 bits
+	///		in CDF-5).
+	///	</summary>
+	bool GetCount(
+		uint64_t & sValue
+	);
+
+	///	<summary>
+	///		Read a file offset from the header (32 bits in CDF-1, otherwise
+	///		64 bits).
+	///	</summary>
+	bool GetOffset(
+		uint64_t & sValue
+	);
+
+	///	<summary>
+	///		Read a padded name from the header.
+	///	</summary>
+	bool GetName(
+		std::string & strName
+	);
+
+	///	<summary>
+	///		Read the tag and element count of a header list.
+	///	</summary>
+	bool GetListHeader(
+		uint32_t iExpectedTag,
+		uint64_t & sElements
+	);
+
+	///	<summary>
+	///		Read an attribute list from the header.
+	///	</summary>
+	bool GetAttributeList(
+		AttributeList & vecAttributes
+	);
+
+	///	<summary>
+	///		Read the raw big-endian values of a one-dimensional variable.
+	///	</summary>
+	bool ReadRawValues(
+		size_t v,
+		size_t sElementSize,
+		std::vector<unsigned char> & vecData
+	) const;
+
+private:
+	///	<summary>
+	///		File descriptor.
+	///	</summary>
+	int m_fd;
+
+	///	<summary>
+	///		Size of the file.
+	///	</summary>
+	uint64_t m_sFileSize;
+
+	///	<summary>
+	///		Format version (1, 2 or 5).
+	///	</summary>
+	int m_iVersion;
+
+	///	<summary>
+	///		Buffered header bytes.
+	///	</summary>
+	std::vector<unsigned char> m_vecHeader;
+
+	///	<summary>
+	///		Current position in the header.
+	///	</summary>
+	uint64_t m_sPos;
+
+	///	<summary>
+	///		Size of one record, over all record variables.
+	///	</summary>
+	uint64_t m_sRecordSize;
+
+	///	<summary>
+	///		Global attributes.
+	///	</summary>
+	AttributeList m_vecAttributes;
+
+	///	<summary>
+	///		Dimensions.
+	///	</summary>
+	std::vector<Dimension> m_vecDimensions;
+
+	///	<summary>
+	///		Variables.
+	///	</summary>
+	std::vector<Variable> m_vecVariables;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
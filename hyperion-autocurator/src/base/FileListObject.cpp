@@ -20,18 +20,400 @@
 #include "DataArray2D.h"
 #include "netcdfcpp.h"
 #include "NetCDFUtilities.h"
+#include "FileSearch.h"
+#include "BinaryStream.h"
 #include "../contrib/tinyxml2.h"
 
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <dirent.h>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iostream>
 #include <iomanip>
+#include <set>
+#include <sstream>
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 #if defined(HYPERION_MPIOMP)
 #include <mpi.h>
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// MPI communication helpers
+///////////////////////////////////////////////////////////////////////////////
+
+#if defined(HYPERION_MPIOMP)
+
+///	<summary>
+///		Maximum number of bytes sent in a single MPI message.
+///	</summary>
+static const size_t MPIMaximumMessageSize = (1 << 30);
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Broadcast a string of arbitrary length from rank 0.
+///	</summary>
+static void BroadcastString(
+	std::string & str
+) {
+	unsigned long long sLength = str.length();
+	MPI_Bcast(&sLength, 1, MPI_UNSIGNED_LONG_LONG, 0, MPI_COMM_WORLD);
+	str.resize(sLength);
+
+	for (size_t s = 0; s < sLength; s += MPIMaximumMessageSize) {
+		size_t sCount = std::min(MPIMaximumMessageSize, static_cast<size_t>(sLength - s));
+		MPI_Bcast(&(str[s]), static_cast<int>(sCount),
+			MPI_CHAR, 0, MPI_COMM_WORLD);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Send a string of arbitrary length to the given rank.
+///	</summary>
+static void SendString(
+	const std::string & str,
+	int iDestRank
+) {
+	unsigned long long sLength = str.length();
+	MPI_Send(&sLength, 1, MPI_UNSIGNED_LONG_LONG,
+		iDestRank, 0, MPI_COMM_WORLD);
+
+	for (size_t s = 0; s < sLength; s += MPIMaximumMessageSize) {
+		size_t sCount = std::min(MPIMaximumMessageSize, static_cast<size_t>(sLength - s));
+		MPI_Send(const_cast<char *>(&(str[s])), static_cast<int>(sCount),
+			MPI_CHAR, iDestRank, 0, MPI_COMM_WORLD);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Receive a string of arbitrary length from the given rank.
+///	</summary>
+static void RecvString(
+	std::string & str,
+	int iSourceRank
+) {
+	unsigned long long sLength;
+	MPI_Recv(&sLength, 1, MPI_UNSIGNED_LONG_LONG,
+		iSourceRank, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+	str.resize(sLength);
+
+	for (size_t s = 0; s < sLength; s += MPIMaximumMessageSize) {
+		size_t sCount = std::min(MPIMaximumMessageSize, static_cast<size_t>(sLength - s));
+		MPI_Recv(&(str[s]), static_cast<int>(sCount),
+			MPI_CHAR, iSourceRank, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Broadcast the result of a file search from rank 0.
+///	</summary>
+static void BroadcastFileSearchResult(
+	std::string & strError,
+	std::string & strBaseDir,
+	std::vector<std::string> & vecFiles
+) {
+	int nCommRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nCommRank);
+
+	std::string strBuffer;
+	if (nCommRank == 0) {
+		std::ostringstream osBuffer;
+		WriteBinary(osBuffer, strError);
+		WriteBinary(osBuffer, strBaseDir);
+		WriteBinary(osBuffer, vecFiles);
+		strBuffer = osBuffer.str();
+	}
+
+	BroadcastString(strBuffer);
+
+	if (nCommRank != 0) {
+		std::istringstream isBuffer(strBuffer);
+		if (!ReadBinary(isBuffer, strError) ||
+		    !ReadBinary(isBuffer, strBaseDir) ||
+		    !ReadBinary(isBuffer, vecFiles)
+		) {
+			_EXCEPTIONT("Corrupt file list received from rank 0");
+		}
+	}
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// VariableTimeFileMap
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Order VariableTimeFileMap segments by time index.
+///	</summary>
+static bool SegmentTimeLess(
+	const VariableTimeFileMap::Segment & seg1,
+	const VariableTimeFileMap::Segment & seg2
+) {
+	return (seg1.m_sTimeBegin < seg2.m_sTimeBegin);
+}
+
+///	<summary>
+///		Order TimeAxis index runs by time index before sorting.
+///	</summary>
+static bool IndexRunLess(
+	const TimeAxis::IndexRun & run1,
+	const TimeAxis::IndexRun & run2
+) {
+	return (run1.m_sIxBegin < run2.m_sIxBegin);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t VariableTimeFileMap::UpperBound(
+	size_t sTime
+) const {
+	size_t sLow = 0;
+	size_t sHigh = m_vecSegments.size();
+	while (sLow < sHigh) {
+		size_t sMid = sLow + (sHigh - sLow) / 2;
+		if (m_vecSegments[sMid].m_sTimeBegin <= sTime) {
+			sLow = sMid + 1;
+		} else {
+			sHigh = sMid;
+		}
+	}
+	return sLow;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool VariableTimeFileMap::Find(
+	size_t sTime,
+	LocalFileTimePair & filetime
+) const {
+	size_t s = UpperBound(sTime);
+	if (s == 0) {
+		return false;
+	}
+
+	const Segment & seg = m_vecSegments[s-1];
+	if (sTime - seg.m_sTimeBegin >= seg.m_sCount) {
+		return false;
+	}
+
+	filetime.first = seg.m_sFile;
+	filetime.second =
+		seg.m_iLocalTimeBegin + static_cast<int>(sTime - seg.m_sTimeBegin);
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool VariableTimeFileMap::Insert(
+	size_t sTime,
+	const LocalFileTimePair & filetime
+) {
+	size_t s = UpperBound(sTime);
+
+	// Already present
+	if (s != 0) {
+		const Segment & segPrev = m_vecSegments[s-1];
+		if (sTime - segPrev.m_sTimeBegin < segPrev.m_sCount) {
+			return false;
+		}
+	}
+
+	m_sCount++;
+
+	// The variable without a time dimension is stored under InvalidTimeIx,
+	// which does not continue any segment
+	if (sTime != FileListObject::InvalidTimeIx) {
+
+		// Extend the previous segment
+		if (s != 0) {
+			Segment & segPrev = m_vecSegments[s-1];
+			if ((segPrev.m_sTimeBegin + segPrev.m_sCount == sTime) &&
+			    (segPrev.m_sFile == filetime.first) &&
+			    (segPrev.m_iLocalTimeBegin + static_cast<int>(segPrev.m_sCount)
+			        == filetime.second)
+			) {
+				segPrev.m_sCount++;
+
+				// Merge with the next segment
+				if (s != m_vecSegments.size()) {
+					const Segment & segNext = m_vecSegments[s];
+					if ((segNext.m_sTimeBegin == sTime + 1) &&
+					    (segNext.m_sFile == filetime.first) &&
+					    (segNext.m_iLocalTimeBegin == filetime.second + 1)
+					) {
+						segPrev.m_sCount += segNext.m_sCount;
+						m_vecSegments.erase(m_vecSegments.begin() + s);
+					}
+				}
+				return true;
+			}
+		}
+
+		// Extend the next segment backwards
+		if (s != m_vecSegments.size()) {
+			Segment & segNext = m_vecSegments[s];
+			if ((segNext.m_sTimeBegin == sTime + 1) &&
+			    (segNext.m_sFile == filetime.first) &&
+			    (segNext.m_iLocalTimeBegin == filetime.second + 1)
+			) {
+				segNext.m_sTimeBegin--;
+				segNext.m_iLocalTimeBegin--;
+				segNext.m_sCount++;
+				return true;
+			}
+		}
+	}
+
+	// New segment
+	Segment seg;
+	seg.m_sTimeBegin = sTime;
+	seg.m_sFile = filetime.first;
+	seg.m_iLocalTimeBegin = filetime.second;
+	seg.m_sCount = 1;
+
+	m_vecSegments.insert(m_vecSegments.begin() + s, seg);
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool VariableTimeFileMap::operator==(
+	const VariableTimeFileMap & map
+) const {
+	if ((m_sCount != map.m_sCount) ||
+	    (m_vecSegments.size() != map.m_vecSegments.size())
+	) {
+		return false;
+	}
+	for (size_t s = 0; s < m_vecSegments.size(); s++) {
+		const Segment & seg1 = m_vecSegments[s];
+		const Segment & seg2 = map.m_vecSegments[s];
+		if ((seg1.m_sTimeBegin != seg2.m_sTimeBegin) ||
+		    (seg1.m_sFile != seg2.m_sFile) ||
+		    (seg1.m_iLocalTimeBegin != seg2.m_iLocalTimeBegin) ||
+		    (seg1.m_sCount != seg2.m_sCount)
+		) {
+			return false;
+		}
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t VariableTimeFileMap::GetHash() const {
+
+	// FNV-1a over the fields of each segment
+	uint64_t uHash = 0xcbf29ce484222325ULL;
+	for (size_t s = 0; s < m_vecSegments.size(); s++) {
+		const Segment & seg = m_vecSegments[s];
+		uHash = (uHash ^ static_cast<uint64_t>(seg.m_sTimeBegin)) * 0x100000001b3ULL;
+		uHash = (uHash ^ static_cast<uint64_t>(seg.m_sFile)) * 0x100000001b3ULL;
+		uHash = (uHash ^ static_cast<uint64_t>(seg.m_iLocalTimeBegin)) * 0x100000001b3ULL;
+		uHash = (uHash ^ static_cast<uint64_t>(seg.m_sCount)) * 0x100000001b3ULL;
+	}
+	return static_cast<size_t>(uHash);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VariableTimeFileMap::Remap(
+	const std::vector<TimeAxis::IndexRun> & vecIndexRuns
+) {
+	if (m_vecSegments.size() == 0) {
+		return;
+	}
+
+	// Runs ordered by time index before sorting
+	std::vector<TimeAxis::IndexRun> vecRunsByIx(vecIndexRuns);
+	std::sort(vecRunsByIx.begin(), vecRunsByIx.end(), IndexRunLess);
+
+	// Split segments at run boundaries and move each piece with its run
+	std::vector<Segment> vecSegments;
+	vecSegments.reserve(m_vecSegments.size() + vecRunsByIx.size());
+
+	size_t r = 0;
+	for (size_t s = 0; s < m_vecSegments.size(); s++) {
+		Segment seg = m_vecSegments[s];
+
+		if (seg.m_sTimeBegin == FileListObject::InvalidTimeIx) {
+			vecSegments.push_back(seg);
+			continue;
+		}
+
+		while (seg.m_sCount != 0) {
+			while ((r < vecRunsByIx.size()) &&
+			       (vecRunsByIx[r].m_sIxBegin + vecRunsByIx[r].m_sCount
+			           <= seg.m_sTimeBegin)
+			) {
+				r++;
+			}
+			if ((r == vecRunsByIx.size()) ||
+			    (vecRunsByIx[r].m_sIxBegin > seg.m_sTimeBegin)
+			) {
+				_EXCEPTIONT("Time index not found in TimeAxis");
+			}
+
+			const TimeAxis::IndexRun & run = vecRunsByIx[r];
+
+			size_t sCount = run.m_sIxBegin + run.m_sCount - seg.m_sTimeBegin;
+			if (sCount > seg.m_sCount) {
+				sCount = seg.m_sCount;
+			}
+
+			Segment segNew;
+			segNew.m_sTimeBegin =
+				run.m_sNewIxBegin + (seg.m_sTimeBegin - run.m_sIxBegin);
+			segNew.m_sFile = seg.m_sFile;
+			segNew.m_iLocalTimeBegin = seg.m_iLocalTimeBegin;
+			segNew.m_sCount = sCount;
+			vecSegments.push_back(segNew);
+
+			seg.m_sTimeBegin += sCount;
+			seg.m_iLocalTimeBegin += static_cast<int>(sCount);
+			seg.m_sCount -= sCount;
+		}
+	}
+
+	std::sort(vecSegments.begin(), vecSegments.end(), SegmentTimeLess);
+
+	// Merge pieces that continue one another
+	m_vecSegments.clear();
+	for (size_t s = 0; s < vecSegments.size(); s++) {
+		const Segment & seg = vecSegments[s];
+		if (m_vecSegments.size() != 0) {
+			Segment & segPrev = m_vecSegments.back();
+			if ((seg.m_sTimeBegin != FileListObject::InvalidTimeIx) &&
+			    (segPrev.m_sTimeBegin + segPrev.m_sCount == seg.m_sTimeBegin) &&
+			    (segPrev.m_sFile == seg.m_sFile) &&
+			    (segPrev.m_iLocalTimeBegin + static_cast<int>(segPrev.m_sCount)
+			        == seg.m_iLocalTimeBegin)
+			) {
+				segPrev.m_sCount += seg.m_sCount;
+				continue;
+			}
+		}
+		m_vecSegments.push_back(seg);
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // DataObjectInfo
 ///////////////////////////////////////////////////////////////////////////////
@@ -41,30 +423,70 @@ std::string DataObjectInfo::FromNcFile(
 	bool fCheckConsistency,
 	const std::string & strFilename
 ) {
-	// Get attributes, if available
-	for (int a = 0; a < ncfile->num_atts(); a++) {
-		NcAtt * att = ncfile->get_att(a);
-		std::string strAttName = att->name();
-		if (strAttName == "units") {
-			continue;
+	DataObjectSummary datasum;
+	datasum.FromNcFile(ncfile);
+
+	return FromFileSummary(datasum, fCheckConsistency, strFilename);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string DataObjectInfo::FromNcVar(
+	NcFile * ncfile,
+	NcVar * var,
+	bool fCheckConsistency
+) {
+	DataObjectSummary datasum;
+	datasum.FromNcVar(ncfile, var);
+
+	return FromVariableSummary(datasum, fCheckConsistency);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string DataObjectInfo::FromFileSummary(
+	const DataObjectSummary & datasum,
+	bool fCheckConsistency,
+	const std::string & strFilename
+) {
+	// Attribute sets that match the first one need no further checks
+	if (!fCheckConsistency) {
+		if (m_mapKeyAttributes.empty() && m_mapOtherAttributes.empty()) {
+			m_uAttributeFingerprint = datasum.m_uAttributeFingerprint;
 		}
+	} else if (datasum.m_uAttributeFingerprint == m_uAttributeFingerprint) {
+		return std::string("");
+	}
+
+	// Get attributes, if available
+	for (size_t a = 0; a < datasum.m_vecAttributes.size(); a++) {
+		const InternedString & strAttName = datasum.m_vecAttributes[a].first;
+		const AttributeValue & attvalue = datasum.m_vecAttributes[a].second;
 
 		// Define new value of this attribute
 		if (!fCheckConsistency) {
-			std::string strAttNameTemp = strAttName;
+			std::pair<AttributeMap::iterator, bool> prInsert;
+
+			std::string strAttNameTemp = strAttName.str();
 			STLStringHelper::ToLower(strAttNameTemp);
 
 			if ((strAttNameTemp == "conventions") ||
 			    (strAttNameTemp == "version") ||
 			    (strAttNameTemp == "history")
 			) {
-				m_mapKeyAttributes.insert(
+				prInsert = m_mapKeyAttributes.insert(
 					AttributeMap::value_type(
-						strAttName, att->as_string(0)));
+						strAttName, attvalue));
 			} else {
-				m_mapOtherAttributes.insert(
+				prInsert = m_mapOtherAttributes.insert(
 					AttributeMap::value_type(
-						strAttName, att->as_string(0)));
+						strAttName, attvalue));
+			}
+
+			// Values kept in the index share storage; values already
+			// present are not replaced
+			if (prInsert.second) {
+				prInsert.first->second.Share();
 			}
 
 		// Check for consistency across files
@@ -75,17 +497,17 @@ std::string DataObjectInfo::FromNcFile(
 				m_mapOtherAttributes.find(strAttName);
 
 			if (iterAttKey != m_mapKeyAttributes.end()) {
-				if (iterAttKey->second != att->as_string(0)) {
+				if (iterAttKey->second != attvalue) {
 					return std::string("ERROR: NetCDF file \"") + strFilename
 						+ std::string("\" has inconsistent value of \"")
-						+ strAttName + std::string("\" across files");
+						+ strAttName.str() + std::string("\" across files");
 				}
 			}
 			if (iterAttOther != m_mapOtherAttributes.end()) {
-				if (iterAttOther->second != att->as_string(0)) {
+				if (iterAttOther->second != attvalue) {
 					return std::string("ERROR: NetCDF file \"") + strFilename
 						+ std::string("\" has inconsistent value of \"")
-						+ strAttName + std::string("\" across files");
+						+ strAttName.str() + std::string("\" across files");
 				}
 			}
 			if ((iterAttKey == m_mapKeyAttributes.end()) &&
@@ -93,7 +515,7 @@ std::string DataObjectInfo::FromNcFile(
 			) {
 				return std::string("ERROR: NetCDF file \"") + strFilename
 					+ std::string("\" has inconsistent appearance of attribute \"")
-					+ strAttName + std::string("\" across files");
+					+ strAttName.str() + std::string("\" across files");
 			}
 		}
 	}
@@ -103,65 +525,73 @@ std::string DataObjectInfo::FromNcFile(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-std::string DataObjectInfo::FromNcVar(
-	NcVar * var,
+std::string DataObjectInfo::FromVariableSummary(
+	const DataObjectSummary & datasum,
 	bool fCheckConsistency
 ) {
 	// Get name, if available
-	std::string strName = var->name();
+	const std::string & strName = datasum.m_strName;
 	if (!fCheckConsistency) {
 		m_strName = strName;
 	} else if (strName != m_strName) {
-		_EXCEPTION2("Calling DataObjectInfo::FromNcVar with mismatched "
-			"variable names: \"%s\" \"%s\"",
+		_EXCEPTION2("Calling DataObjectInfo::FromVariableSummary with "
+			"mismatched variable names: \"%s\" \"%s\"",
 			strName.c_str(), m_strName.c_str());
 	}
 
 	// Get type, if available
-	NcType nctype = var->type();
 	if (!fCheckConsistency) {
-		m_nctype = nctype;
-	} else if (nctype != m_nctype) {
+		m_nctype = datasum.m_nctype;
+	} else if (datasum.m_nctype != m_nctype) {
 		return std::string("ERROR: Variable \"") + strName
 			+ std::string("\" has inconsistent type across files");
 	}
 
 	// Get units, if available
-	std::string strUnits;
-	NcAtt * attUnits = var->get_att("units");
-	if (attUnits != NULL) {
-		strUnits = attUnits->as_string(0);
-	}
 	if (!fCheckConsistency) {
-		m_strUnits = strUnits;
-	} else if (strUnits != m_strUnits) {
+		m_strUnits = datasum.m_strUnits;
+	} else if (datasum.m_strUnits != m_strUnits) {
 		return std::string("ERROR: Variable \"") + strName
 			+ std::string("\" has inconsistent units across files");
 	}
 
-	// Get attributes, if available
-	for (int a = 0; a < var->num_atts(); a++) {
-		NcAtt * att = var->get_att(a);
-		std::string strAttName = att->name();
-		if (strAttName == "units") {
-			continue;
+	// Attribute sets that match the first one need no further checks
+	if (!fCheckConsistency) {
+		if (m_mapKeyAttributes.empty() && m_mapOtherAttributes.empty()) {
+			m_uAttributeFingerprint = datasum.m_uAttributeFingerprint;
 		}
+	} else if (datasum.m_uAttributeFingerprint == m_uAttributeFingerprint) {
+		return std::string("");
+	}
+
+	// Get attributes, if available
+	for (size_t a = 0; a < datasum.m_vecAttributes.size(); a++) {
+		const InternedString & strAttName = datasum.m_vecAttributes[a].first;
+		const AttributeValue & attvalue = datasum.m_vecAttributes[a].second;
 
 		// Define new value of this attribute
 		if (!fCheckConsistency) {
+			std::pair<AttributeMap::iterator, bool> prInsert;
+
 			if ((strAttName == "missing_value") ||
 			    (strAttName == "comments") ||
 			    (strAttName == "long_name") ||
 			    (strAttName == "grid_name") ||
 			    (strAttName == "grid_type")
 			) {
-				m_mapKeyAttributes.insert(
+				prInsert = m_mapKeyAttributes.insert(
 					AttributeMap::value_type(
-						strAttName, att->as_string(0)));
+						strAttName, attvalue));
 			} else {
-				m_mapOtherAttributes.insert(
+				prInsert = m_mapOtherAttributes.insert(
 					AttributeMap::value_type(
-						strAttName, att->as_string(0)));
+						strAttName, attvalue));
+			}
+
+			// Values kept in the index share storage; values already
+			// present are not replaced
+			if (prInsert.second) {
+				prInsert.first->second.Share();
 			}
 
 		// Check for consistency across files
@@ -172,17 +602,17 @@ std::string DataObjectInfo::FromNcVar(
 				m_mapOtherAttributes.find(strAttName);
 
 			if (iterAttKey != m_mapKeyAttributes.end()) {
-				if (iterAttKey->second != att->as_string(0)) {
+				if (iterAttKey->second != attvalue) {
 					return std::string("ERROR: Variable \"") + strName
 						+ std::string("\" has inconsistent value of \"")
-						+ strAttName + std::string("\" across files");
+						+ strAttName.str() + std::string("\" across files");
 				}
 			}
 			if (iterAttOther != m_mapOtherAttributes.end()) {
-				if (iterAttOther->second != att->as_string(0)) {
+				if (iterAttOther->second != attvalue) {
 					return std::string("ERROR: Variable \"") + strName
 						+ std::string("\" has inconsistent value of \"")
-						+ strAttName + std::string("\" across files");
+						+ strAttName.str() + std::string("\" across files");
 				}
 			}
 			if ((iterAttKey == m_mapKeyAttributes.end()) &&
@@ -190,7 +620,7 @@ std::string DataObjectInfo::FromNcVar(
 			) {
 				return std::string("ERROR: Variable \"") + strName
 					+ std::string("\" has inconsistent appearance of attribute \"")
-					+ strAttName + std::string("\" across files");
+					+ strAttName.str() + std::string("\" across files");
 			}
 		}
 	}
@@ -259,17 +689,6 @@ const long FileListObject::InconsistentDimensionSizes = (-1);
 
 ///////////////////////////////////////////////////////////////////////////////
 
-FileListObject::~FileListObject() {
-	for (int v = 0; v < m_vecVariableInfo.size(); v++) {
-		delete m_vecVariableInfo[v];
-	}
-	for (int d = 0; d < m_vecDimensionInfo.size(); d++) {
-		delete m_vecDimensionInfo[d];
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
 std::string FileListObject::Call(
 	const ObjectRegistry & objreg,
 	const std::string & strFunctionName,
@@ -323,8 +742,7 @@ std::string FileListObject::Call(
 		}
 
 		// Copy times
-		pobjNewFileList->m_vecTimes = m_vecTimes;
-		pobjNewFileList->m_mapTimeToIndex = m_mapTimeToIndex;
+		pobjNewFileList->m_timeaxis = m_timeaxis;
 		pobjNewFileList->m_strTimeUnits = m_strTimeUnits;
 
 /*
@@ -386,106 +804,265 @@ std::string FileListObject::Call(
 std::string FileListObject::PopulateFromSearchString(
 	const std::string & strSearchString
 ) {
-	// Check if already initialized
-	if (m_vecFilenames.size() != 0) {
-		_EXCEPTIONT("FileListObject has already been initialized");
+	// Find all files that match the search string
+	std::string strBaseDir;
+	std::vector<std::string> vecFiles;
+	std::string strError;
+
+#if defined(HYPERION_MPIOMP)
+	// Only search directories on rank 0
+	int nCommRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nCommRank);
+
+	if (nCommRank == 0) {
+		strError =
+			FindFilesFromSearchString(
+				strSearchString, m_nThreads, strBaseDir, vecFiles);
+	}
+	BroadcastFileSearchResult(strError, strBaseDir, vecFiles);
+#else
+	strError =
+		FindFilesFromSearchString(
+			strSearchString, m_nThreads, strBaseDir, vecFiles);
+#endif
+
+	if (strError != "") {
+		return strError;
 	}
 
-	// File the directory in the search string
-	std::string strFileSearchString;
-	for (int i = strSearchString.length(); i >= 0; i--) {
-		if (strSearchString[i] == '/') {
-			m_strBaseDir = strSearchString.substr(0,i+1);
-			strFileSearchString =
-				strSearchString.substr(i+1, std::string::npos);
-			break;
-		}
+	// When appending files from a different directory, switch to storing
+	// full paths for all files
+	if (m_filenames.GetCount() == 0) {
+		m_strBaseDir = strBaseDir;
 	}
-	if ((m_strBaseDir == "") && (strFileSearchString == "")) {
-		strFileSearchString = strSearchString;
-		m_strBaseDir = "./";
+
+	if (strBaseDir != m_strBaseDir) {
+		m_filenames.PrependDirectory(m_strBaseDir);
+		m_strBaseDir = "";
 	}
 
-	// Open the directory
-	DIR * pDir = opendir(m_strBaseDir.c_str());
-	if (pDir == NULL) {
-		return std::string("Unable to open directory \"")
-			+ m_strBaseDir + std::string("\"");
+	// Files that have already been indexed are skipped
+	std::set<std::string> setIndexedFilenames;
+	for (size_t f = 0; f < m_filenames.GetCount(); f++) {
+		setIndexedFilenames.insert(m_filenames.Get(f));
 	}
 
-	// Search all files in the directory for match to search string
-	size_t iFileBegin = m_vecFilenames.size();
-	struct dirent * pDirent;
-	while ((pDirent = readdir(pDir)) != NULL) {
-		std::string strFilename = pDirent->d_name;
-		if (STLStringHelper::WildcardMatch(
-				strFileSearchString.c_str(),
-				strFilename.c_str())
+	// Store filenames relative to the base directory
+	size_t iFileBegin = m_filenames.GetCount();
+	for (size_t f = 0; f < vecFiles.size(); f++) {
+		std::string strFilename = vecFiles[f].substr(m_strBaseDir.length());
+		if (setIndexedFilenames.find(strFilename) !=
+		    setIndexedFilenames.end()
 		) {
-			// File found, insert into list of filenames
-			m_vecFilenames.push_back(strFilename);
+			continue;
 		}
+		m_filenames.Add(strFilename);
 	}
-	closedir(pDir);
+
+	Announce("Found %lu new files", m_filenames.GetCount() - iFileBegin);
 
 	// Index the variable data
-	return IndexVariableData(iFileBegin, m_vecFilenames.size());
+	return IndexVariableData(iFileBegin, m_filenames.GetCount());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-std::string FileListObject::CreateFilesFromTemplate(
-	const std::string & strFilenameTemplate,
-	const GridObject * pobjGrid,
-	int nTimesPerFile
+///	<summary>
+///		Read a list of paths from the given file, or from standard input
+///		if the filename is "-".  Paths are NUL-delimited if the first
+///		block of the file contains a NUL character and newline-delimited
+///		otherwise.  Empty paths are skipped.
+///	</summary>
+static std::string ReadFileList(
+	const std::string & strFileList,
+	std::vector<std::string> & vecPaths
 ) {
-	if (pobjGrid == NULL) {
-		_EXCEPTION();
-	}
-
-	// Search for time specifier in template
-	int iTemplatePos = (-1);
-	for (int i = 0; i < strFilenameTemplate.length()-1; i++) {
-		if ((strFilenameTemplate[i] == '%') &&
-			(strFilenameTemplate[i+1] == 'T')
-		) {
-			if (iTemplatePos == (-1)) {
-				iTemplatePos = i;
-			} else {
-				return std::string("ERROR: Time specifier appears more than once in filename template");
+	// Open the list of files
+	std::ifstream ifFileList;
+	std::istream * pisFileList = &std::cin;
+	if (strFileList != "-") {
+		ifFileList.open(strFileList.c_str(), std::ios::binary);
+		if (!ifFileList.is_open()) {
+			return std::string("Unable to open file list \"")
+				+ strFileList + std::string("\"");
+		}
+		pisFileList = &ifFileList;
+	}
+
+	// Read paths in blocks
+	const size_t BlockSize = 65536;
+	std::vector<char> vecBlock(BlockSize);
+	std::string strPartialPath;
+	char cDelimiter = '\0';
+	bool fFirstBlock = true;
+
+	for (;;) {
+		pisFileList->read(&(vecBlock[0]), BlockSize);
+		size_t sRead = pisFileList->gcount();
+
+		if (fFirstBlock) {
+			if (memchr(&(vecBlock[0]), '\0', sRead) == NULL) {
+				cDelimiter = '\n';
 			}
+			fFirstBlock = false;
 		}
-	}
-	if (iTemplatePos == (-1)) {
-		return std::string("ERROR: Time specifier missing from filename template");
-	}
 
-	// Loop through all times
-	for (int t = 0; t < m_vecTimes.size(); t += nTimesPerFile) {
-		std::string strFilename =
-			strFilenameTemplate.substr(0,iTemplatePos)
-			+ m_vecTimes[t].ToShortString()
-			+ strFilenameTemplate.substr(iTemplatePos+2, std::string::npos);
+		// Append the remaining partial path after the final block
+		bool fFinalBlock = (sRead < BlockSize);
+		if (fFinalBlock) {
+			vecBlock.resize(sRead);
+			vecBlock.push_back(cDelimiter);
+			sRead++;
+		}
 
-		// Create the file from the Grid
-		std::string strError =
-			CreateFileNoTime(
-				strFilename,
-				pobjGrid);
+		const char * pBegin = &(vecBlock[0]);
+		const char * pEnd = pBegin + sRead;
+		for (;;) {
+			const char * pDelimiter =
+				static_cast<const char *>(
+					memchr(pBegin, cDelimiter, pEnd - pBegin));
 
-		if (strError != "") {
-			return strError;
-		}
+			if (pDelimiter == NULL) {
+				strPartialPath.append(pBegin, pEnd);
+				break;
+			}
 
-		// Add record dimension
-		std::string strFullFilename = m_strBaseDir + strFilename;
-		NcFile ncFile(strFullFilename.c_str(), NcFile::Write);
-		if (!ncFile.is_valid()) {
-			return std::string("ERROR: Unable to open \"")
-				+ strFilename + std::string("\" for writing");
-		}
+			strPartialPath.append(pBegin, pDelimiter);
+			pBegin = pDelimiter + 1;
 
-		if (m_strRecordDimName == "") {
+			if ((cDelimiter == '\n') &&
+			    (strPartialPath.length() != 0) &&
+			    (strPartialPath[strPartialPath.length()-1] == '\r')
+			) {
+				strPartialPath.resize(strPartialPath.length()-1);
+			}
+
+			if (strPartialPath != "") {
+				vecPaths.push_back(strPartialPath);
+			}
+			strPartialPath.clear();
+		}
+
+		if (fFinalBlock) {
+			break;
+		}
+	}
+
+	if (pisFileList->bad()) {
+		return std::string("Error reading file list \"")
+			+ strFileList + std::string("\"");
+	}
+
+	return std::string("");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string FileListObject::PopulateFromFileList(
+	const std::string & strFileList
+) {
+	// Read the list of files
+	std::string strError;
+	std::vector<std::string> vecPaths;
+
+#if defined(HYPERION_MPIOMP)
+	// Only read the list on rank 0, which may be the only rank with
+	// access to standard input
+	int nCommRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nCommRank);
+
+	std::string strBaseDir;
+	if (nCommRank == 0) {
+		strError = ReadFileList(strFileList, vecPaths);
+	}
+	BroadcastFileSearchResult(strError, strBaseDir, vecPaths);
+#else
+	strError = ReadFileList(strFileList, vecPaths);
+#endif
+
+	if (strError != "") {
+		return strError;
+	}
+
+	// Paths are stored as given
+	if (m_strBaseDir != "") {
+		m_filenames.PrependDirectory(m_strBaseDir);
+		m_strBaseDir = "";
+	}
+
+	// Files that have already been indexed are skipped
+	std::set<std::string> setIndexedFilenames;
+	for (size_t f = 0; f < m_filenames.GetCount(); f++) {
+		setIndexedFilenames.insert(m_filenames.Get(f));
+	}
+
+	size_t iFileBegin = m_filenames.GetCount();
+	for (size_t f = 0; f < vecPaths.size(); f++) {
+		if (setIndexedFilenames.insert(vecPaths[f]).second) {
+			m_filenames.Add(vecPaths[f]);
+		}
+	}
+
+	Announce("Found %lu new files", m_filenames.GetCount() - iFileBegin);
+
+	// Index the variable data
+	return IndexVariableData(iFileBegin, m_filenames.GetCount());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string FileListObject::CreateFilesFromTemplate(
+	const std::string & strFilenameTemplate,
+	const GridObject * pobjGrid,
+	int nTimesPerFile
+) {
+	if (pobjGrid == NULL) {
+		_EXCEPTION();
+	}
+
+	// Search for time specifier in template
+	int iTemplatePos = (-1);
+	for (int i = 0; i < strFilenameTemplate.length()-1; i++) {
+		if ((strFilenameTemplate[i] == '%') &&
+			(strFilenameTemplate[i+1] == 'T')
+		) {
+			if (iTemplatePos == (-1)) {
+				iTemplatePos = i;
+			} else {
+				return std::string("ERROR: Time specifier appears more than once in filename template");
+			}
+		}
+	}
+	if (iTemplatePos == (-1)) {
+		return std::string("ERROR: Time specifier missing from filename template");
+	}
+
+	// Loop through all times
+	for (int t = 0; t < m_timeaxis.GetCount(); t += nTimesPerFile) {
+		std::string strFilename =
+			strFilenameTemplate.substr(0,iTemplatePos)
+			+ m_timeaxis.GetTime(t).ToShortString()
+			+ strFilenameTemplate.substr(iTemplatePos+2, std::string::npos);
+
+		// Create the file from the Grid
+		std::string strError =
+			CreateFileNoTime(
+				strFilename,
+				pobjGrid);
+
+		if (strError != "") {
+			return strError;
+		}
+
+		// Add record dimension
+		std::string strFullFilename = m_strBaseDir + strFilename;
+		NcFile ncFile(strFullFilename.c_str(), NcFile::Write);
+		if (!ncFile.is_valid()) {
+			return std::string("ERROR: Unable to open \"")
+				+ strFilename + std::string("\" for writing");
+		}
+
+		if (m_strRecordDimName == "") {
 			return std::string("ERROR: NetCDF file template has no record dimension");
 		}
 
@@ -512,14 +1089,14 @@ std::string FileListObject::CreateFilesFromTemplate(
 
 		// Output times
 		int nTimes = nTimesPerFile;
-		if (t + nTimes >= m_vecTimes.size()) {
-			nTimes = m_vecTimes.size() - t;
+		if (t + nTimes >= m_timeaxis.GetCount()) {
+			nTimes = m_timeaxis.GetCount() - t;
 		}
 
 		std::vector<double> dTimes;
 		dTimes.resize(nTimes);
 		for (int s = 0; s < nTimes; s++) {
-			dTimes[s] = m_vecTimes[t+s].GetCFCompliantUnitsOffsetDouble(m_strTimeUnits);
+			dTimes[s] = m_timeaxis.GetTime(t+s).GetCFCompliantUnitsOffsetDouble(m_strTimeUnits);
 		}
 		varRecord->put(&(dTimes[0]), nTimes);
 
@@ -610,11 +1187,10 @@ std::string FileListObject::SetReduceTarget(
 ) {
 
 	// Check if file exists
-	for (size_t f = 0; f < m_vecFilenames.size(); f++) {
-		if (m_vecFilenames[f] == strTargetFilename) {
-			m_sReduceTargetIx = f;
-			return std::string("");
-		}
+	size_t sFileIx = m_filenames.Find(strTargetFilename);
+	if (sFileIx != m_filenames.GetCount()) {
+		m_sReduceTargetIx = sFileIx;
+		return std::string("");
 	}
 
 	return std::string("ERROR: Reduce target not in file_list");
@@ -625,15 +1201,7 @@ std::string FileListObject::SetReduceTarget(
 bool FileListObject::IsCompatible(
 	const FileListObject * pobjFileList
 ) {
-	if (m_vecTimes.size() != pobjFileList->m_vecTimes.size()) {
-		return false;
-	}
-	for (size_t t = 0; t < m_vecTimes.size(); t++) {
-		if (m_vecTimes[t] != pobjFileList->m_vecTimes[t]) {
-			return false;
-		}
-	}
-	return true;
+	return (m_timeaxis == pobjFileList->m_timeaxis);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -647,7 +1215,7 @@ void FileListObject::GetOnRankTimeIndices(
 	}
 
 #if defined(HYPERION_MPIOMP)
-	size_t sTimeCount = m_vecTimes.size() / sTimeStride;
+	size_t sTimeCount = m_timeaxis.GetCount() / sTimeStride;
 
 	int nCommRank;
 	MPI_Comm_rank(MPI_COMM_WORLD, &nCommRank);
@@ -670,7 +1238,7 @@ void FileListObject::GetOnRankTimeIndices(
 		vecTimeIndices.push_back(i * sTimeStride);
 	}
 #else
-	for (size_t i = 0; i < m_vecTimes.size(); i += sTimeStride) {
+	for (size_t i = 0; i < m_timeaxis.GetCount(); i += sTimeStride) {
 		vecTimeIndices.push_back(i);
 	}
 #endif
@@ -684,12 +1252,7 @@ std::string FileListObject::LoadData_float(
 	DataArray1D<float> & data
 ) {
 	// Find the VariableInfo structure for this Variable
-	size_t iVarInfo = 0;
-	for (; iVarInfo < m_vecVariableInfo.size(); iVarInfo++) {
-		if (strVariableName == m_vecVariableInfo[iVarInfo]->m_strName) {
-			break;
-		}
-	}
+	size_t iVarInfo = FindVariableInfoIx(strVariableName);
 	if (iVarInfo == m_vecVariableInfo.size()) {
 		_EXCEPTION1("Variable \"%s\" not found in file_list index",
 			strVariableName.c_str());
@@ -712,15 +1275,13 @@ std::string FileListObject::LoadData_float(
 	}
 
 	// Find local file/time index
-	VariableTimeFileMap::const_iterator iter =
-		varinfo.m_mapTimeFile.find(sTime);
-
-	if (iter == varinfo.m_mapTimeFile.end()) {
+	LocalFileTimePair filetime;
+	if (!varinfo.m_pmapTimeFile->Find(sTime, filetime)) {
 		_EXCEPTION2("sTime (%s) (%lu) not found", strVariableName.c_str(), sTime);
 	}
 
-	size_t sFile = iter->second.first;
-	int iTime = iter->second.second;
+	size_t sFile = filetime.first;
+	int iTime = filetime.second;
 
 	{
 		std::string strLoading =
@@ -730,7 +1291,7 @@ std::string FileListObject::LoadData_float(
 			if (d == varinfo.m_iTimeDimIx) {
 				strLoading +=
 					std::string(" [")
-					+ m_vecTimes[sTime].ToString()
+					+ m_timeaxis.GetTime(sTime).ToString()
 					+ std::string("]");
 			} else {
 				strLoading +=
@@ -744,15 +1305,16 @@ std::string FileListObject::LoadData_float(
 		Announce(strLoading.c_str());
 	}
 
-	// Open the correct NetCDF file
-	std::string strFullFilename = m_strBaseDir + m_vecFilenames[sFile];
-	NcFile ncfile(strFullFilename.c_str());
-	if (!ncfile.is_valid()) {
-		_EXCEPTION1("Cannot open file \"%s\"", strFullFilename.c_str());
+	// Open the correct NetCDF file, flushing any pending writes to it
+	m_filenames.GetPath(m_strBaseDir, sFile, m_strFullFilename);
+	m_ncfcacheWrite.Close(m_strFullFilename);
+	NcFile * pncfile = m_ncfcacheRead.Get(m_strFullFilename);
+	if (pncfile == NULL) {
+		_EXCEPTION1("Cannot open file \"%s\"", m_strFullFilename.c_str());
 	}
 
 	// Get the correct variable from the file
-	NcVar * var = ncfile.get_var(strVariableName.c_str());
+	NcVar * var = pncfile->get_var(strVariableName.c_str());
 	const long nDims = var->num_dims() - m_vecGridDimNames.size();
 
 	if (var == NULL) {
@@ -825,9 +1387,6 @@ std::string FileListObject::LoadData_float(
 		_EXCEPTION1("NetCDF Fatal Error (%i)", err.get_err());
 	}
 
-	// Cleanup
-	ncfile.close();
-
 	return std::string("");
 }
 
@@ -839,12 +1398,7 @@ std::string FileListObject::WriteData_float(
 	const DataArray1D<float> & data
 ) {
 	// Find the VariableInfo structure for this Variable
-	size_t iVarInfo = 0;
-	for (; iVarInfo < m_vecVariableInfo.size(); iVarInfo++) {
-		if (strVariableName == m_vecVariableInfo[iVarInfo]->m_strName) {
-			break;
-		}
-	}
+	size_t iVarInfo = FindVariableInfoIx(strVariableName);
 
 	// File index for write
 	size_t sFile = (-1);
@@ -878,7 +1432,7 @@ std::string FileListObject::WriteData_float(
 			if (d == varinfo.m_iTimeDimIx) {
 				strWriting +=
 					std::string(" [")
-					+ m_vecTimes[sTime].ToString()
+					+ m_timeaxis.GetTime(sTime).ToString()
 					+ std::string("]");
 			} else {
 				strWriting +=
@@ -902,10 +1456,8 @@ std::string FileListObject::WriteData_float(
 			"variable as multi-indexed variable");
 	}
 
-	VariableTimeFileMap::const_iterator iterTimeFile =
-		varinfo.m_mapTimeFile.find(sTime);
-
-	if (iterTimeFile == varinfo.m_mapTimeFile.end()) {
+	LocalFileTimePair filetime;
+	if (!varinfo.m_pmapTimeFile->Find(sTime, filetime)) {
 		if (sTime == InvalidTimeIx) {
 			sFile = m_sReduceTargetIx;
 			iLocalTime = (-1);
@@ -921,15 +1473,14 @@ std::string FileListObject::WriteData_float(
 			sFile = iterFileIx->second.first;
 			iLocalTime = iterFileIx->second.second;
 
-			varinfo.m_mapTimeFile.insert(
-				VariableTimeFileMap::value_type(
-					sTime,
-					LocalFileTimePair(sFile, iLocalTime)));
+			varinfo.GetUniqueTimeFileMap().Insert(
+				sTime,
+				LocalFileTimePair(sFile, iLocalTime));
 		}
 
 	} else {
-		sFile = iterTimeFile->second.first;
-		iLocalTime = iterTimeFile->second.second;
+		sFile = filetime.first;
+		iLocalTime = filetime.second;
 	}
 
 	if (sFile == (-1)) {
@@ -967,18 +1518,20 @@ std::string FileListObject::WriteData_float(
 		_EXCEPTION2("Data size mismatch (%i/%lu)", data.GetRows(), lTotalSize);
 	}
 
-	// Write data
-	std::string strFullFilename = m_strBaseDir + m_vecFilenames[sFile];
-	NcFile ncout(strFullFilename.c_str(), NcFile::Write);
-	if (!ncout.is_valid()) {
-		_EXCEPTION1("Unable to open output file \"%s\"", strFullFilename.c_str());
+	// Write data, closing any handle that would not see the new data
+	m_filenames.GetPath(m_strBaseDir, sFile, m_strFullFilename);
+	m_ncfcacheRead.Close(m_strFullFilename);
+	NcFile * pncout = m_ncfcacheWrite.Get(m_strFullFilename);
+	if (pncout == NULL) {
+		_EXCEPTION1("Unable to open output file \"%s\"", m_strFullFilename.c_str());
 	}
+	NcFile & ncout = *pncout;
 
 	// Get dimensions
 	std::vector<NcDim *> vecDims;
 	vecDims.resize(varinfo.m_vecDimNames.size());
 	for (int d = 0; d < vecDims.size(); d++) {
-		long lDimSize = GetDimensionSize(varinfo.m_vecDimNames[d]);
+		long lDimSize = GetDimensionSize(varinfo.m_vecDimNames[d].str());
 		vecDims[d] = ncout.get_dim(varinfo.m_vecDimNames[d].c_str());
 		if (vecDims[d] != NULL) {
 			if (d != varinfo.m_iTimeDimIx) {
@@ -1003,7 +1556,7 @@ std::string FileListObject::WriteData_float(
 			}
 
 			DimensionInfoMap::const_iterator iterDimInfo =
-				m_mapDimensionInfo.find(varinfo.m_vecDimNames[d]);
+				m_mapDimensionInfo.find(varinfo.m_vecDimNames[d].str());
 
 			// Create a dimension variable in output file
 			if (iterDimInfo->second.m_dValuesDouble.size() != 0) {
@@ -1049,9 +1602,13 @@ std::string FileListObject::WriteData_float(
 	// Set current position
 	var->set_cur(&(vecPos[0]));
 
-	// Write data
+	// Write data and flush it, so the slice is on disk when this returns
 	var->put(&(data[0]), &(vecSize[0]));
 
+	if (!ncout.sync()) {
+		_EXCEPTION1("Unable to flush output file \"%s\"", m_strFullFilename.c_str());
+	}
+
 	return std::string("");
 }
 
@@ -1549,51 +2106,22 @@ long FileListObject::GetDimensionSize(
 
 void FileListObject::SortTimeArray() {
 
-	if (m_vecTimes.size() != m_mapTimeToIndex.size()) {
-		_EXCEPTIONT("vecTimes / mapTimeToIndex mismatch");
-	}
-
-	// Check if the array needs sorting, and map from old indices to new
-	bool fSorted = true;
-	std::map<size_t, size_t>  mapTimeIxToNewTimeIx;
-	std::map<Time, size_t>::iterator iterTime = m_mapTimeToIndex.begin();
-	for (size_t i = 0; iterTime != m_mapTimeToIndex.end(); iterTime++, i++) {
-		if ((fSorted) && (i != iterTime->second)) {
-			fSorted = false;
-		}
-		mapTimeIxToNewTimeIx.insert(
-			std::pair<size_t, size_t>(iterTime->second, i));
-	}
-
-	if (fSorted) {
+	// Sort the TimeAxis; each segment is a run of time indices (usually
+	// the times of one file) that is moved as a block
+	std::vector<TimeAxis::IndexRun> vecIndexRuns;
+	if (!m_timeaxis.Sort(vecIndexRuns)) {
 		return;
 	}
 
-	// Sort m_vecTimes and m_mapTimeToIndex
-	iterTime = m_mapTimeToIndex.begin();
-	for (size_t i = 0; iterTime != m_mapTimeToIndex.end(); iterTime++, i++) {
-		m_vecTimes[i] = iterTime->first;
-		iterTime->second = i;
-	}
-
-	// Rebuild VariableInfo VariableTimeFileMap with new time indices
-	for (size_t i = 0; i < m_vecVariableInfo.size(); i++) {	
-		VariableTimeFileMap mapTimeFileBak = m_vecVariableInfo[i]->m_mapTimeFile;
-		m_vecVariableInfo[i]->m_mapTimeFile.clear();
+	// Move the segments of each VariableTimeFileMap with the runs;
+	// maps shared by several variables are only remapped once
+	std::set<VariableTimeFileMap *> setRemapped;
+	for (size_t i = 0; i < m_vecVariableInfo.size(); i++) {
+		VariableTimeFileMap * pmapTimeFile =
+			m_vecVariableInfo[i]->m_pmapTimeFile.get();
 
-		VariableTimeFileMap::const_iterator iterFileMap = mapTimeFileBak.begin();
-		for (; iterFileMap != mapTimeFileBak.end(); iterFileMap++) {
-			if (iterFileMap->first == InvalidTimeIx) {
-				m_vecVariableInfo[i]->m_mapTimeFile.insert(
-					VariableTimeFileMap::value_type(
-						InvalidTimeIx,
-						iterFileMap->second));
-			} else {
-				m_vecVariableInfo[i]->m_mapTimeFile.insert(
-					VariableTimeFileMap::value_type(
-						mapTimeIxToNewTimeIx[iterFileMap->first],
-						iterFileMap->second));
-			}
+		if (setRemapped.insert(pmapTimeFile).second) {
+			pmapTimeFile->Remap(vecIndexRuns);
 		}
 	}
 /*
@@ -1609,433 +2137,593 @@ void FileListObject::SortTimeArray() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-std::string FileListObject::IndexVariableData(
-	size_t sFileIxBegin,
-	size_t sFileIxEnd
-) {
-	std::string strError;
 
-	// Check if we're appending to an already populated FileListObject
-	bool fAppendIndex =
-		(m_vecVariableInfo.size() != 0) ||
-		(m_vecDimensionInfo.size() != 0);
+///	<summary>
+///		A pool of threads that builds the FileSummary for each file in a
+///		list.  Summaries are handed back to the caller in list order, so
+///		merging them produces the same index as a serial scan.  Workers
+///		stay within a window of files past the last released summary,
+///		so memory use does not grow with the length of the list.
+///	</summary>
+class FileSummaryWorkerPool {
+
+public:
+	///	<summary>
+	///		Number of files each thread may run ahead of the caller.
+	///	</summary>
+	static const size_t WindowPerThread = 4;
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FileSummaryWorkerPool(
+		const std::vector<std::string> & vecFullFilenames,
+		const std::string & strRecordDimName,
+		int nThreads,
+		FileSummaryCache * pcache = NULL,
+		const std::vector<std::string> & vecCacheKeys
+			= std::vector<std::string>()
+	) :
+		m_vecFullFilenames(vecFullFilenames),
+		m_strRecordDimName(strRecordDimName),
+		m_pcache(pcache),
+		m_vecCacheKeys(vecCacheKeys),
+		m_vecSummaries(vecFullFilenames.size()),
+		m_vecFileStats(vecFullFilenames.size()),
+		m_vecHasFileStat(vecFullFilenames.size(), 0),
+		m_vecReady(vecFullFilenames.size(), false),
+		m_sNext(0),
+		m_sReleased(0),
+		m_sWindow(0),
+		m_fAbort(false)
+	{
+		if (nThreads > static_cast<int>(vecFullFilenames.size())) {
+			nThreads = static_cast<int>(vecFullFilenames.size());
+		}
+		if (nThreads > 1) {
+			m_sWindow = WindowPerThread * static_cast<size_t>(nThreads);
 
-	// Open all files
-	if (sFileIxBegin == InvalidFileIx) {
-		sFileIxBegin = 0;
-	}
-	if (sFileIxEnd == InvalidFileIx) {
-		sFileIxEnd = m_vecFilenames.size();
+			for (int i = 0; i < nThreads; i++) {
+				m_vecThreads.push_back(
+					std::thread(&FileSummaryWorkerPool::Work, this));
+			}
+		}
 	}
 
-	for (size_t f = sFileIxBegin; f < sFileIxEnd; f++) {
+	///	<summary>
+	///		Destructor.
+	///	</summary>
+	~FileSummaryWorkerPool() {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_fAbort = true;
+			m_condRoom.notify_all();
+		}
+		for (size_t i = 0; i < m_vecThreads.size(); i++) {
+			m_vecThreads[i].join();
+		}
+	}
 
-		// Open the NetCDF file
-		std::string strFullFilename = m_strBaseDir + m_vecFilenames[f];
-		NcFile ncFile(strFullFilename.c_str(), NcFile::ReadOnly);
-		if (!ncFile.is_valid()) {
-			return std::string("Unable to open data file \"")
-				+ strFullFilename + std::string("\" for reading");
+public:
+	///	<summary>
+	///		Get the FileSummary with the given index, waiting for it to
+	///		be built if necessary.
+	///	</summary>
+	FileSummary & Get(size_t i) {
+		if (m_vecThreads.size() == 0) {
+			SummarizeOrFail(i);
+			return m_vecSummaries[i];
 		}
 
-		printf("Indexing %s\n", strFullFilename.c_str());
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (!m_vecReady[i]) {
+			m_condReady.wait(lock);
+		}
+		return m_vecSummaries[i];
+	}
 
-		// Load in global attributes
-		strError = m_datainfo.FromNcFile(&ncFile, fAppendIndex, strFullFilename);
-		if (strError != "") return strError;
+	///	<summary>
+	///		Get the FileStat recorded before the FileSummary with the
+	///		given index was built, or NULL if the file was not stat'ed.
+	///		Only valid after Get().
+	///	</summary>
+	const FileStat * GetFileStat(size_t i) const {
+		if (m_vecHasFileStat[i]) {
+			return &(m_vecFileStats[i]);
+		}
+		return NULL;
+	}
 
-		// time indices stored in this file
-		std::vector<size_t> vecFileTimeIndices;
+	///	<summary>
+	///		Free the memory associated with the FileSummary with the
+	///		given index.
+	///	</summary>
+	void Release(size_t i) {
+		FileSummary filesumEmpty;
+		std::swap(m_vecSummaries[i], filesumEmpty);
 
-		// Find the time variable, if it exists
-		NcVar * varTime = ncFile.get_var(m_strRecordDimName.c_str());
-		if (varTime != NULL) {
-			if (varTime->num_dims() != 1) {
-				return std::string("\"")
-					+ m_strRecordDimName
-					+ std::string("\" variable must contain exactly one dimension in \"")
-					+ m_vecFilenames[f] + std::string("\"");
-			}
-			if ((varTime->type() != ncInt) && (varTime->type() != ncDouble)) {
-				return std::string("\"")
-					+ m_strRecordDimName
-					+ std::string("\" variable must be ncInt or ncDouble in \"")
-					+ m_vecFilenames[f] + std::string("\"");
+		if (m_vecThreads.size() != 0) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (i + 1 > m_sReleased) {
+				m_sReleased = i + 1;
+				m_condRoom.notify_all();
 			}
+		}
+	}
+
+protected:
+	///	<summary>
+	///		Build the FileSummary with the given index, using the cache
+	///		if one is available.
+	///	</summary>
+	void Summarize(size_t i) {
+		FileSummary & filesum = m_vecSummaries[i];
 
-			Time::CalendarType timecal;
+		FileStat & filestat = m_vecFileStats[i];
+		bool fCacheable =
+			(m_pcache != NULL) &&
+			filestat.FromFile(m_vecFullFilenames[i]);
 
-			NcDim * dimTime = varTime->get_dim(0);
-			if (dimTime == NULL) {
-				_EXCEPTION1("Malformed NetCDF file \"%s\"",
-					m_vecFilenames[f].c_str());
+		m_vecHasFileStat[i] = (fCacheable)?(1):(0);
+
+		if (fCacheable) {
+			if (m_pcache->Lookup(m_vecCacheKeys[i], filestat, filesum)) {
+				filesum.m_strFilename = m_vecFullFilenames[i];
+				return;
 			}
+		}
 
-			// Get calendar
-			NcAtt * attTimeCalendar = varTime->get_att("calendar");
-			if (attTimeCalendar == NULL) {
-				timecal = Time::CalendarStandard;
-			} else {
-				std::string strTimeCalendar = attTimeCalendar->as_string(0);
-				timecal = Time::CalendarTypeFromString(strTimeCalendar);
-				if (timecal == Time::CalendarUnknown) {
-					return std::string("Unknown calendar \"") + strTimeCalendar
-						+ std::string("\" in \"")
-						+ m_vecFilenames[f] + std::string("\"");
+		filesum.FromFile(m_vecFullFilenames[i], m_strRecordDimName);
+
+		if (fCacheable && (filesum.m_strError == "")) {
+			m_pcache->Insert(m_vecCacheKeys[i], filestat, filesum);
+		}
+	}
+
+	///	<summary>
+	///		Build the FileSummary with the given index, recording any
+	///		exception as the error of the summary.  An exception must not
+	///		escape a worker thread, and the caller waits for every file
+	///		to be marked ready.
+	///	</summary>
+	void SummarizeOrFail(size_t i) {
+		std::string strError;
+		try {
+			Summarize(i);
+			return;
+
+		} catch(Exception & e) {
+			strError = e.ToString();
+		} catch(std::exception & e) {
+			strError = e.what();
+		} catch(...) {
+			strError = "Unknown exception";
+		}
+
+		FileSummary & filesum = m_vecSummaries[i];
+		filesum = FileSummary();
+		filesum.m_strFilename = m_vecFullFilenames[i];
+		filesum.m_strError =
+			std::string("ERROR: Unable to summarize \"")
+			+ m_vecFullFilenames[i] + std::string("\": ") + strError;
+		m_vecHasFileStat[i] = 0;
+	}
+
+	///	<summary>
+	///		Build summaries until the list is exhausted, waiting while
+	///		the next file is outside the window.
+	///	</summary>
+	void Work() {
+		for (;;) {
+			size_t i;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				while ((!m_fAbort) &&
+				       (m_sNext < m_vecSummaries.size()) &&
+				       (m_sNext >= m_sReleased + m_sWindow)
+				) {
+					m_condRoom.wait(lock);
+				}
+				if ((m_fAbort) || (m_sNext >= m_vecSummaries.size())) {
+					break;
 				}
+				i = m_sNext++;
 			}
 
-			// Get units attribute
-			NcAtt * attTimeUnits = varTime->get_att("units");
-			if (attTimeUnits != NULL) {
-				m_strTimeUnits = attTimeUnits->as_string(0);
-			}
-			if (m_strTimeUnits == "") {
-				return std::string("Unknown units for \"")
-					+ m_strRecordDimName
-					+ std::string("\" in \"")
-					+ m_vecFilenames[f] + std::string("\"");
-			}
+			SummarizeOrFail(i);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_vecReady[i] = true;
+			m_condReady.notify_all();
+		}
+	}
+
+protected:
+	///	<summary>
+	///		Full paths of all files.
+	///	</summary>
+	const std::vector<std::string> & m_vecFullFilenames;
+
+	///	<summary>
+	///		Name of the record dimension.
+	///	</summary>
+	std::string m_strRecordDimName;
+
+	///	<summary>
+	///		Cache of FileSummary objects (or NULL).
+	///	</summary>
+	FileSummaryCache * m_pcache;
+
+	///	<summary>
+	///		Key of each file in the cache.
+	///	</summary>
+	std::vector<std::string> m_vecCacheKeys;
+
+	///	<summary>
+	///		FileSummary for each file.
+	///	</summary>
+	std::vector<FileSummary> m_vecSummaries;
+
+	///	<summary>
+	///		FileStat of each file, recorded when a cache is in use.
+	///	</summary>
+	std::vector<FileStat> m_vecFileStats;
+
+	///	<summary>
+	///		Flag indicating m_vecFileStats holds a valid FileStat.
+	///	</summary>
+	std::vector<char> m_vecHasFileStat;
+
+	///	<summary>
+	///		Flag indicating each FileSummary has been built.
+	///	</summary>
+	std::vector<bool> m_vecReady;
+
+	///	<summary>
+	///		Index of the next file to be summarized.
+	///	</summary>
+	size_t m_sNext;
+
+	///	<summary>
+	///		Number of files at the start of the list that have been
+	///		released by the caller.
+	///	</summary>
+	size_t m_sReleased;
+
+	///	<summary>
+	///		Number of files past m_sReleased that may be summarized.
+	///	</summary>
+	size_t m_sWindow;
+
+	///	<summary>
+	///		Flag indicating worker threads should stop.
+	///	</summary>
+	bool m_fAbort;
+
+	///	<summary>
+	///		Mutex guarding m_vecReady, m_sNext, m_sReleased and m_fAbort.
+	///	</summary>
+	std::mutex m_mutex;
+
+	///	<summary>
+	///		Condition signalled when a FileSummary is ready.
+	///	</summary>
+	std::condition_variable m_condReady;
+
+	///	<summary>
+	///		Condition signalled when the window advances or the pool
+	///		is stopped.
+	///	</summary>
+	std::condition_variable m_condRoom;
+
+	///	<summary>
+	///		Worker threads.
+	///	</summary>
+	std::vector<std::thread> m_vecThreads;
+};
 
-			// Add Times to master array and store corresponding indices
-			// in vecFileTimeIndices.
-			DataArray1D<int> nTimes(dimTime->size());
-			if (varTime->type() == ncInt) {
-				varTime->set_cur((long)0);
-				varTime->get(&(nTimes[0]), dimTime->size());
-			}
+///////////////////////////////////////////////////////////////////////////////
 
-			DataArray1D<double> dTimes(dimTime->size());
-			if (varTime->type() == ncDouble) {
-				varTime->set_cur((long)0);
-				varTime->get(&(dTimes[0]), dimTime->size());
-			}
+std::string FileListObject::IndexVariableData(
+	size_t sFileIxBegin,
+	size_t sFileIxEnd
+) {
+	std::string strError;
 
-			for (int t = 0; t < dimTime->size(); t++) {
-				Time time(timecal);
-				if (m_strTimeUnits != "") {
-					if (varTime->type() == ncInt) {
-						time.FromCFCompliantUnitsOffsetInt(
-							m_strTimeUnits,
-							nTimes[t]);
+	// Open all files
+	if (sFileIxBegin == InvalidFileIx) {
+		sFileIxBegin = 0;
+	}
+	if (sFileIxEnd == InvalidFileIx) {
+		sFileIxEnd = m_filenames.GetCount();
+	}
 
-					} else if (varTime->type() == ncDouble) {
-						time.FromCFCompliantUnitsOffsetDouble(
-							m_strTimeUnits,
-							dTimes[t]);
-					}
-				}
+#if defined(HYPERION_MPIOMP)
+	// Distribute files across ranks
+	int nCommSize;
+	MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
 
-				std::map<Time, size_t>::const_iterator iterTime =
-					m_mapTimeToIndex.find(time);
+	if (nCommSize > 1) {
+		return IndexVariableDataDistributed(sFileIxBegin, sFileIxEnd);
+	}
+#endif
 
-				if (iterTime == m_mapTimeToIndex.end()) {
-					size_t sNewIndex = m_vecTimes.size();
-					m_vecTimes.push_back(time);
-					vecFileTimeIndices.push_back(sNewIndex);
-					m_mapTimeToIndex.insert(
-						std::pair<Time, size_t>(time, sNewIndex));
-				} else {
-					vecFileTimeIndices.push_back(iterTime->second);
-				}
-			}
-		}
+	std::vector<std::string> vecFullFilenames(sFileIxEnd - sFileIxBegin);
+	for (size_t f = sFileIxBegin; f < sFileIxEnd; f++) {
+		m_filenames.GetPath(
+			m_strBaseDir, f, vecFullFilenames[f - sFileIxBegin]);
+	}
 
-		printf("..File contains %lu times\n", vecFileTimeIndices.size());
+	// Files are cached by absolute path
+	std::vector<std::string> vecCacheKeys;
+	if (m_pcache != NULL) {
+		GetCacheKeys(sFileIxBegin, sFileIxEnd, vecCacheKeys);
+	}
 
-		// Index all Dimensions
-		printf("..Loading dimensions\n");
-		const int nDims = ncFile.num_dims();
-		for (int d = 0; d < nDims; d++) {
-			NcDim * dim = ncFile.get_dim(d);
-			std::string strDimName(dim->name());
-			DimensionInfoMap::iterator iterDim =
-				m_mapDimensionInfo.find(strDimName);
+	// Summarize files (possibly concurrently) and merge them in order
+	{
+		FileSummaryWorkerPool pool(
+			vecFullFilenames,
+			m_strRecordDimName,
+			m_nThreads,
+			m_pcache,
+			vecCacheKeys);
 
-			//printf("....Dimension %i (%s)\n", d, strDimName.c_str());
+		for (size_t f = sFileIxBegin; f < sFileIxEnd; f++) {
+			strError =
+				IndexFileSummary(f, pool.Get(f - sFileIxBegin));
 
-			// New variable, not yet indexed
-			bool fNewDimension = false;
+			if (strError != "") return strError;
 
-			// Find the corresponding DimensionInfo structure
-			size_t sDimIndex = 0;
-			for (; sDimIndex < m_vecDimensionInfo.size(); sDimIndex++) {
-				if (strDimName == m_vecDimensionInfo[sDimIndex]->m_strName) {
-					break;
-				}
-			}
-			if (sDimIndex == m_vecDimensionInfo.size()) {
-				m_vecDimensionInfo.push_back(
-					new DimensionInfo(strDimName));
+			pool.Release(f - sFileIxBegin);
+		}
+	}
 
-				fNewDimension = true;
-			}
+	// Sort times and update dimension information
+	FinalizeIndex();
 
-			DimensionInfo & diminfo = *(m_vecDimensionInfo[sDimIndex]);
+	return std::string("");
+}
 
-			// Store size
-			if (fNewDimension) {
-				diminfo.m_lSize = dim->size();
-			}
+///////////////////////////////////////////////////////////////////////////////
 
-			// Check for variable
-			NcVar * varDim = ncFile.get_var(strDimName.c_str());
-			if (varDim != NULL) {
-				if (varDim->num_dims() != 1) {
-					return std::string("ERROR: Dimension variable \"")
-						+ varDim->name()
-						+ std::string("\" must have exactly 1 dimension");
-				}
-				if (std::string(varDim->get_dim(0)->name()) != strDimName) {
-					return std::string("ERROR: Dimension variable \"")
-						+ varDim->name()
-						+ std::string("\" does not have dimension \"");
-						+ varDim->name()
-						+ std::string("\"");
-				}
+void FileListObject::GetCacheKeys(
+	size_t sFileIxBegin,
+	size_t sFileIxEnd,
+	std::vector<std::string> & vecCacheKeys
+) const {
+	char szRealPath[PATH_MAX];
+	std::string strRealBaseDir = m_strBaseDir;
+	if (realpath(m_strBaseDir.c_str(), szRealPath) != NULL) {
+		strRealBaseDir = std::string(szRealPath) + std::string("/");
+	}
 
-				// Initialize the DataObjectInfo from the NcVar
-				strError = diminfo.FromNcVar(varDim, !fNewDimension);
-				if (strError != "") return strError;
-
-				// Get the values from the dimension
-				if (fNewDimension) {
-					if (diminfo.m_nctype == ncDouble) {
-						diminfo.m_dValuesDouble.resize(diminfo.m_lSize);
-						varDim->set_cur((long)0);
-						varDim->get(&(diminfo.m_dValuesDouble[0]), diminfo.m_lSize);
-					} else if (diminfo.m_nctype == ncFloat) {
-						diminfo.m_dValuesFloat.resize(diminfo.m_lSize);
-						varDim->set_cur((long)0);
-						varDim->get(&(diminfo.m_dValuesFloat[0]), diminfo.m_lSize);
-					} else {
-						_EXCEPTIONT("Unsupported dimension nctype");
-					}
-				}
-/*
-				// Dimension is of type vertical
-				if ((strDimName == "lev") ||
-					(strDimName == "pres") ||
-					(strDimName == "z") ||
-					(strDimName == "plev")
-				) {
-					diminfo.m_eType = DimensionInfo::Type_Vertical;
-
-					// Determine order of dimension
-
-					// Find the variable associated with this dimension
-					if (varDim != NULL) {
-
-						// Check for presence of "positive" attribute
-						NcAtt * attPositive = varDim->get_att("positive");
-						if (attPositive != NULL) {
-							if (std::string("down") == attPositive->as_string(0)) {
-								diminfo.m_nOrder = (-1);
-							}
-
-						// Obtain orientation from values
-						} else {
-
-							// Dimension variable is of type double
-							if (varDim->type() == ncDouble) {
-
-								// Positive orientation (bottom-up)
-								if (diminfo.m_dValues[1] > diminfo.m_dValues[0]) {
-									diminfo.m_nOrder = (+1);
-									for (size_t s = 0; s < diminfo.m_dValues.size()-1; s++) {
-										if (diminfo.m_dValues[s+1] < diminfo.m_dValues[s]) {
-											_EXCEPTION1("Dimension variable \"%s\" is not monotone",
-												strDimName.c_str());
-										}
-									}
-
-								// Negative orientation (top-down)
-								} else {
-									diminfo.m_nOrder = (-1);
-									for (size_t s = 0; s < diminfo.m_dValues.size()-1; s++) {
-										if (diminfo.m_dValues[s+1] > diminfo.m_dValues[s]) {
-											_EXCEPTION1("Dimension variable \"%s\" is not monotone",
-												strDimName.c_str());
-										}
-									}
-								}
-
-							} else {
-								_EXCEPTION1("Unknown type for dimension variable \"%s\"",
-									strDimName.c_str());
-							}
-						}
-					}
+	vecCacheKeys.resize(sFileIxEnd - sFileIxBegin);
+	for (size_t f = sFileIxBegin; f < sFileIxEnd; f++) {
+		m_filenames.GetPath(
+			strRealBaseDir, f, vecCacheKeys[f - sFileIxBegin]);
+	}
+}
 
-				// Record dimension
-				} else if (strDimName == m_strRecordDimName) {
-					diminfo.m_eType = DimensionInfo::Type_Record;
+///////////////////////////////////////////////////////////////////////////////
 
-				// Auxiliary dimension
-				} else {
-					diminfo.m_eType = DimensionInfo::Type_Auxiliary;
-				}
+#if defined(HYPERION_MPIOMP)
+std::string FileListObject::IndexVariableDataDistributed(
+	size_t sFileIxBegin,
+	size_t sFileIxEnd
+) {
+	int nCommRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nCommRank);
+
+	int nCommSize;
+	MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
 
-				// Insert dimension into dimension info map
-				m_mapDimensionInfo.insert(
-					DimensionInfoMap::value_type(
-						strDimName, diminfo));
+	// Block partition of files across ranks
+	std::vector<size_t> vecRankFileIxBegin(nCommSize+1);
+	for (int r = 0; r <= nCommSize; r++) {
+		vecRankFileIxBegin[r] =
+			sFileIxBegin
+			+ ((sFileIxEnd - sFileIxBegin) * r) / nCommSize;
+	}
 
-			} else if (iterDim->second.m_lSize != dim->size()) {
-				_EXCEPTIONT("Inconsistent dimension sizes");
-*/
+	// Summarize files on this rank
+	std::string strRecords;
+	{
+		size_t sLocalBegin = vecRankFileIxBegin[nCommRank];
+		size_t sLocalEnd = vecRankFileIxBegin[nCommRank+1];
+
+		std::vector<std::string> vecFullFilenames(sLocalEnd - sLocalBegin);
+		for (size_t f = sLocalBegin; f < sLocalEnd; f++) {
+			m_filenames.GetPath(
+				m_strBaseDir, f, vecFullFilenames[f - sLocalBegin]);
+		}
+
+		std::vector<std::string> vecCacheKeys;
+		if (m_pcache != NULL) {
+			GetCacheKeys(sLocalBegin, sLocalEnd, vecCacheKeys);
+		}
+
+		FileSummaryWorkerPool pool(
+			vecFullFilenames,
+			m_strRecordDimName,
+			m_nThreads,
+			m_pcache,
+			vecCacheKeys);
+
+		// Each record is a FileStat (if available) followed by the
+		// FileSummary.  Files after the first failure are not needed.
+		// An exception is recorded as a failed summary so that no rank
+		// is left waiting on a message that is never sent.
+		std::ostringstream osRecords;
+		for (size_t i = 0; i < vecFullFilenames.size(); i++) {
+			FileSummary filesumError;
+			const FileSummary * pfilesum = &filesumError;
+			const FileStat * pfilestat = NULL;
+			try {
+				pfilesum = &(pool.Get(i));
+				pfilestat = pool.GetFileStat(i);
+
+			} catch(Exception & e) {
+				filesumError.m_strFilename = vecFullFilenames[i];
+				filesumError.m_strError = e.ToString();
 			}
-		}
 
-		// Loop over all Variables
-		printf("..Loading variables\n");
-		const int nVariables = ncFile.num_vars();
-		for (int v = 0; v < nVariables; v++) {
-			NcVar * var = ncFile.get_var(v);
-			if (var == NULL) {
-				_EXCEPTION1("Malformed NetCDF file \"%s\"",
-					m_vecFilenames[f].c_str());
+			WriteBinary<uint8_t>(osRecords, (pfilestat != NULL)?(1):(0));
+			if (pfilestat != NULL) {
+				WriteBinary<uint64_t>(osRecords, pfilestat->m_sSize);
+				WriteBinary<int64_t>(osRecords, pfilestat->m_iModTimeSec);
+				WriteBinary<int64_t>(osRecords, pfilestat->m_iModTimeNSec);
+				WriteBinary<uint64_t>(osRecords, pfilestat->m_sInode);
+				WriteBinary<uint64_t>(osRecords, pfilestat->m_sDevice);
 			}
+			pfilesum->Serialize(osRecords);
 
-			std::string strVariableName = var->name();
-
-			// Don't index dimension variables
-			bool fDimensionVar = false;
-			for (int d = 0; d < m_vecDimensionInfo.size(); d++) {
-				if (m_vecDimensionInfo[d]->m_strName == strVariableName) {
-					fDimensionVar = true;
-					break;
-				}
+			bool fFailed = (pfilesum->m_strError != "");
+			if (pfilesum != &filesumError) {
+				pool.Release(i);
 			}
-			if (fDimensionVar) {
-				continue;
+			if (fFailed) {
+				break;
 			}
+		}
+		strRecords = osRecords.str();
+	}
 
-			//printf("....Variable %i (%s)\n", v, strVariableName.c_str());
-
-			// New variable, not yet indexed
-			bool fNewVariable = false;
-
-			// Find the corresponding VariableInfo structure
-			size_t sVarIndex = 0;
-			for (; sVarIndex < m_vecVariableInfo.size(); sVarIndex++) {
-				if (strVariableName == m_vecVariableInfo[sVarIndex]->m_strName) {
-					break;
-				}
-			}
-			if (sVarIndex == m_vecVariableInfo.size()) {
-				m_vecVariableInfo.push_back(
-					new VariableInfo(strVariableName));
+	// Rank 0 gathers the summaries from all ranks in rank order and
+	// broadcasts them, so that every rank builds the full index
+	if (nCommRank != 0) {
+		SendString(strRecords, 0);
 
-				fNewVariable = true;
+	} else {
+		std::ostringstream osAllRecords;
+		for (int r = 0; r < nCommSize; r++) {
+			if (r != 0) {
+				RecvString(strRecords, r);
 			}
+			WriteBinary(osAllRecords, strRecords);
+		}
+		strRecords = osAllRecords.str();
+	}
 
-			VariableInfo & info = *(m_vecVariableInfo[sVarIndex]);
+	BroadcastString(strRecords);
 
-			// Initialize the DataObjectInfo from the NcVar
-			strError = info.FromNcVar(var, !fNewVariable);
-			if (strError != "") return strError;
+	// Merge summaries in file order
+	std::vector<std::string> vecCacheKeys;
+	if ((m_pcache != NULL) && (nCommRank == 0)) {
+		GetCacheKeys(sFileIxBegin, sFileIxEnd, vecCacheKeys);
+	}
 
-			// Load dimension information
-			const int nDims = var->num_dims();
-/*
-			if (info.m_vecDimSizes.size() != 0) {
-				if (info.m_vecDimSizes.size() != nDims) {
-					return std::string("Variable \"") + strVariableName
-						+ std::string("\" has inconsistent dimensionality across files");
-				}
+	std::string strError;
+	try {
+		std::istringstream isAllRecords(strRecords);
+		strRecords.clear();
+
+		for (int r = 0; r < nCommSize; r++) {
+			std::string strRankRecords;
+			if (!ReadBinary(isAllRecords, strRankRecords)) {
+				_EXCEPTION1("Corrupt file summaries received from rank %i", r);
 			}
-*/
-			info.m_vecDimNames.resize(nDims);
-			info.m_vecDimSizes.resize(nDims);
-			for (int d = 0; d < nDims; d++) {
-				info.m_vecDimNames[d] = var->get_dim(d)->name();
-
-				if (info.m_vecDimNames[d] == m_strRecordDimName) {
-					if (info.m_iTimeDimIx == (-1)) {
-						info.m_iTimeDimIx = d;
-					} else if (info.m_iTimeDimIx != d) {
-						return std::string("ERROR: Variable \"") + strVariableName
-							+ std::string("\" has inconsistent \"time\" dimension across files");
-					}
-					info.m_vecDimSizes[d] = (-1);
-				} else {
-					info.m_vecDimSizes[d] = var->get_dim(d)->size();
+
+			std::istringstream isRecords(strRankRecords);
+			for (size_t f = vecRankFileIxBegin[r]; f < vecRankFileIxBegin[r+1]; f++) {
+				if (isRecords.peek() == EOF) {
+					break;
 				}
 
-				if ((info.m_vecDimNames[d] == "lev") ||
-					(info.m_vecDimNames[d] == "pres") ||
-					(info.m_vecDimNames[d] == "z") ||
-					(info.m_vecDimNames[d] == "plev")
-				) {
-					if (info.m_iVerticalDimIx != (-1)) {
-						if (info.m_iVerticalDimIx != d) {
-							return std::string("ERROR: Possibly multiple vertical dimensions in variable ")
-								+ info.m_strName;
-						}
-					}
-					info.m_iVerticalDimIx = d;
+				uint8_t iHasFileStat;
+				FileStat filestat;
+				FileSummary filesum;
+
+				bool fValid = ReadBinary<uint8_t>(isRecords, iHasFileStat);
+				if (fValid && (iHasFileStat != 0)) {
+					fValid =
+						ReadBinary<uint64_t>(isRecords, filestat.m_sSize) &&
+						ReadBinary<int64_t>(isRecords, filestat.m_iModTimeSec) &&
+						ReadBinary<int64_t>(isRecords, filestat.m_iModTimeNSec) &&
+						ReadBinary<uint64_t>(isRecords, filestat.m_sInode) &&
+						ReadBinary<uint64_t>(isRecords, filestat.m_sDevice);
+				}
+				if (fValid) {
+					fValid = filesum.Deserialize(isRecords);
+				}
+				if (!fValid) {
+					_EXCEPTION1("Corrupt file summaries received from rank %i", r);
 				}
-			}
-/*
-			// Determine direction of vertical dimension
-			if (info.m_iVerticalDimIx != (-1)) {
-				DimensionInfoMap::iterator iterDimInfo =
-					m_mapDimensionInfo.find(info.m_vecDimNames[info.m_iVerticalDimIx]);
 
-				if (iterDimInfo != m_mapDimensionInfo.end()) {
-					info.m_nVerticalDimOrder = iterDimInfo->second.m_nOrder;
+				strError = IndexFileSummary(f, filesum);
+				if (strError != "") {
+					break;
+				}
 
-				} else {
-					_EXCEPTIONT("Logic error");
+				// The cache is only written on rank 0
+				if ((vecCacheKeys.size() != 0) && (iHasFileStat != 0)) {
+					m_pcache->Insert(
+						vecCacheKeys[f - sFileIxBegin], filestat, filesum);
 				}
 			}
-*/
-			// No time information on this Variable
-			if (info.m_iTimeDimIx == (-1)) {
-				if (info.m_mapTimeFile.size() == 0) {
-					info.m_mapTimeFile.insert(
-						std::pair<size_t, LocalFileTimePair>(
-							InvalidTimeIx,
-							LocalFileTimePair(f, 0)));
-
-				} else if (info.m_mapTimeFile.size() == 1) {
-					VariableTimeFileMap::const_iterator iterTimeFile =
-						info.m_mapTimeFile.begin();
-
-					if (iterTimeFile->first != InvalidTimeIx) {
-						return std::string("Variable \"") + strVariableName
-							+ std::string("\" has inconsistent \"time\" dimension across files");
-					}
+			if (strError != "") {
+				break;
+			}
+		}
 
-				} else {
-					return std::string("Variable \"") + strVariableName
-						+ std::string("\" has inconsistent \"time\" dimension across files");
-				}
+		if (strError == "") {
+			FinalizeIndex();
+		}
 
-			// Add file and time indices to VariableInfo
-			} else {
-				for (int t = 0; t < vecFileTimeIndices.size(); t++) {
-					VariableTimeFileMap::const_iterator iterTimeFile =
-						info.m_mapTimeFile.find(vecFileTimeIndices[t]);
-
-					if (iterTimeFile == info.m_mapTimeFile.end()) {
-						info.m_mapTimeFile.insert(
-							std::pair<size_t, LocalFileTimePair>(
-								vecFileTimeIndices[t],
-								LocalFileTimePair(f, t)));
-
-					} else {
-						return std::string("Variable \"") + strVariableName
-							+ std::string("\" has repeated time across files:\n")
-							+ std::string("Time: ") + m_vecTimes[vecFileTimeIndices[t]].ToString() + std::string("\n")
-							+ std::string("File1: ") + m_vecFilenames[iterTimeFile->second.first] + std::string("\n")
-							+ std::string("File2: ") + m_vecFilenames[f];
-					}
-				}
+	} catch(Exception & e) {
+		strError = e.ToString();
+	}
+
+	// All ranks report the same status
+	BroadcastString(strError);
+
+	return strError;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FileListObject::ShareTimeFileMaps() {
+
+	// Distinct maps keyed by the hash of their segments, so each map is
+	// only compared in full against maps with the same hash
+	typedef std::unordered_multimap<
+		size_t, std::shared_ptr<VariableTimeFileMap> > DistinctMap;
+
+	DistinctMap mapDistinct;
+
+	for (size_t v = 0; v < m_vecVariableInfo.size(); v++) {
+		std::shared_ptr<VariableTimeFileMap> & pmapTimeFile =
+			m_vecVariableInfo[v]->m_pmapTimeFile;
+
+		size_t sHash = pmapTimeFile->GetHash();
+
+		std::pair<DistinctMap::iterator, DistinctMap::iterator> range =
+			mapDistinct.equal_range(sHash);
+
+		DistinctMap::iterator iter = range.first;
+		for (; iter != range.second; iter++) {
+			if ((iter->second == pmapTimeFile) ||
+			    ((*(iter->second)) == (*pmapTimeFile))
+			) {
+				break;
 			}
 		}
+		if (iter == range.second) {
+			mapDistinct.insert(DistinctMap::value_type(sHash, pmapTimeFile));
+		} else {
+			pmapTimeFile = iter->second;
+		}
 	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FileListObject::FinalizeIndex() {
+
+	// Share identical time coverage between variables
+	ShareTimeFileMaps();
 
 	// Sort the Time array
 	SortTimeArray();
@@ -2051,7 +2739,7 @@ std::string FileListObject::IndexVariableData(
 				_EXCEPTIONT("Logic error");
 			}
 			varinfo.m_vecDimSizes[iTimeDimIx] =
-				varinfo.m_mapTimeFile.size();
+				varinfo.m_pmapTimeFile->GetCount();
 		}
 
 		// Initialize auxiliary dimension information for all variables
@@ -2060,25 +2748,339 @@ std::string FileListObject::IndexVariableData(
 		for (size_t d = 0; d < varinfo.m_vecDimSizes.size(); d++) {
 			bool fFound = false;
 			for (int g = 0; g < m_vecGridDimNames.size(); g++) {
-				if (m_vecGridDimNames[g] == varinfo.m_vecDimNames[d]) {
+				if (m_vecGridDimNames[g] == varinfo.m_vecDimNames[d].str()) {
 					fFound = true;
 					break;
 				}
 			}
 			if (!fFound) {
 				varinfo.m_vecAuxDimNames.push_back(
-					varinfo.m_vecDimNames[d]);
+					varinfo.m_vecDimNames[d].str());
 				varinfo.m_vecAuxDimSizes.push_back(
 					varinfo.m_vecDimSizes[d]);
 			}
 		}
 	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string FileListObject::IndexFileSummary(
+	size_t f,
+	const FileSummary & filesum
+) {
+	std::string strError;
+
+	// File could not be opened
+	if (filesum.m_strError != "") {
+		return filesum.m_strError;
+	}
+
+	const std::string & strFullFilename = filesum.m_strFilename;
+
+	printf("Indexing %s\n", strFullFilename.c_str());
+
+	// Load in global attributes.  These are not checked for consistency,
+	// since per-file attributes (tracking_id, creation_date, history)
+	// differ between files; the first value of each attribute is kept.
+	strError = m_datainfo.FromFileSummary(
+		filesum.m_datainfo, false, strFullFilename);
+	if (strError != "") return strError;
+
+	// time indices stored in this file
+	std::vector<size_t> vecFileTimeIndices;
+
+	// Add Times to master array and store corresponding indices
+	// in vecFileTimeIndices.
+	if (filesum.m_fHasTimeVariable) {
+		if (filesum.m_strTimeError != "") {
+			return filesum.m_strTimeError;
+		}
+
+		if (filesum.m_fHasTimeUnits) {
+			m_strTimeUnits = filesum.m_strTimeUnits;
+		}
+		if (m_strTimeUnits == "") {
+			return std::string("Unknown units for \"")
+				+ m_strRecordDimName
+				+ std::string("\" in \"")
+				+ m_filenames.Get(f) + std::string("\"");
+		}
+
+		// Files without units of their own use those of a previous file
+		std::vector<Time> vecDecodedTimes;
+		const std::vector<Time> * pvecTimes = &(filesum.m_vecTimes);
+		if (!filesum.HasDecodedTimes()) {
+			FileSummary::DecodeTimeValues(
+				m_strTimeUnits,
+				filesum.m_eTimeCalendar,
+				filesum.m_nctypeTime,
+				filesum.m_dTimeValues,
+				vecDecodedTimes);
+			pvecTimes = &vecDecodedTimes;
+		}
+
+		// Times are only comparable within a calendar
+		if ((m_timeaxis.GetCount() != 0) && (pvecTimes->size() != 0) &&
+		    (m_timeaxis.GetTime(0).GetCalendarType() != filesum.m_eTimeCalendar)
+		) {
+			_EXCEPTIONT("Cannot compare Time objects with different calendars");
+		}
+
+		vecFileTimeIndices.reserve(pvecTimes->size());
+		for (size_t t = 0; t < pvecTimes->size(); t++) {
+			bool fInserted;
+			vecFileTimeIndices.push_back(
+				m_timeaxis.Insert((*pvecTimes)[t], fInserted));
+		}
+	}
+
+	printf("..File contains %lu times\n", vecFileTimeIndices.size());
+
+	// Index all Dimensions
+	printf("..Loading dimensions\n");
+	for (size_t d = 0; d < filesum.m_vecDimensions.size(); d++) {
+		const DimensionSummary & dimsum = filesum.m_vecDimensions[d];
+		const std::string & strDimName = dimsum.m_strName;
+
+		// New variable, not yet indexed
+		bool fNewDimension = false;
+
+		// Find the corresponding DimensionInfo structure
+		size_t sDimIndex = FindDimensionInfoIx(strDimName);
+		if (sDimIndex == m_vecDimensionInfo.size()) {
+			AddDimensionInfo(strDimName);
+
+			fNewDimension = true;
+		}
+
+		DimensionInfo & diminfo = *(m_vecDimensionInfo[sDimIndex]);
+
+		// Store size
+		if (fNewDimension) {
+			diminfo.m_lSize = dimsum.m_lSize;
+		}
+
+		// Check for variable
+		if (dimsum.m_fHasVariable) {
+			if (dimsum.m_strError != "") {
+				return dimsum.m_strError;
+			}
+
+			// Initialize the DataObjectInfo from the summary
+			strError = diminfo.FromVariableSummary(dimsum, !fNewDimension);
+			if (strError != "") return strError;
+
+			// Get the values from the dimension
+			if (fNewDimension) {
+				if (diminfo.m_nctype == ncDouble) {
+					diminfo.m_dValuesDouble = dimsum.m_dValuesDouble;
+				} else if (diminfo.m_nctype == ncFloat) {
+					diminfo.m_dValuesFloat = dimsum.m_dValuesFloat;
+				} else {
+					_EXCEPTIONT("Unsupported dimension nctype");
+				}
+			}
+		}
+	}
+
+	// Loop over all Variables
+	printf("..Loading variables\n");
+	std::vector<size_t> vecFileVarIx;
+	for (size_t v = 0; v < filesum.m_vecVariables.size(); v++) {
+		const VariableSummary & varsum = filesum.m_vecVariables[v];
+		const std::string & strVariableName = varsum.m_strName;
+
+		// Don't index dimension variables
+		if (FindDimensionInfoIx(strVariableName) != m_vecDimensionInfo.size()) {
+			continue;
+		}
+
+		// New variable, not yet indexed
+		bool fNewVariable = false;
+
+		// Find the corresponding VariableInfo structure
+		size_t sVarIndex = FindVariableInfoIx(strVariableName);
+		if (sVarIndex == m_vecVariableInfo.size()) {
+			AddVariableInfo(strVariableName);
+
+			fNewVariable = true;
+		}
+
+		VariableInfo & info = *(m_vecVariableInfo[sVarIndex]);
+
+		// Initialize the DataObjectInfo from the summary
+		strError = info.FromVariableSummary(varsum, !fNewVariable);
+		if (strError != "") return strError;
+
+		// Load dimension information
+		const int nDims = varsum.m_vecDimNames.size();
+/*
+		if (info.m_vecDimSizes.size() != 0) {
+			if (info.m_vecDimSizes.size() != nDims) {
+				return std::string("Variable \"") + strVariableName
+					+ std::string("\" has inconsistent dimensionality across files");
+			}
+		}
+*/
+		info.m_vecDimNames.resize(nDims);
+		info.m_vecDimSizes.resize(nDims);
+		for (int d = 0; d < nDims; d++) {
+			info.m_vecDimNames[d] = varsum.m_vecDimNames[d];
+
+			if (info.m_vecDimNames[d] == m_strRecordDimName) {
+				if (info.m_iTimeDimIx == (-1)) {
+					info.m_iTimeDimIx = d;
+				} else if (info.m_iTimeDimIx != d) {
+					return std::string("ERROR: Variable \"") + strVariableName
+						+ std::string("\" has inconsistent \"time\" dimension across files");
+				}
+				info.m_vecDimSizes[d] = (-1);
+			} else {
+				info.m_vecDimSizes[d] = varsum.m_vecDimSizes[d];
+			}
+
+			if ((info.m_vecDimNames[d] == "lev") ||
+				(info.m_vecDimNames[d] == "pres") ||
+				(info.m_vecDimNames[d] == "z") ||
+				(info.m_vecDimNames[d] == "plev")
+			) {
+				if (info.m_iVerticalDimIx != (-1)) {
+					if (info.m_iVerticalDimIx != d) {
+						return std::string("ERROR: Possibly multiple vertical dimensions in variable ")
+							+ info.m_strName;
+					}
+				}
+				info.m_iVerticalDimIx = d;
+			}
+		}
+
+		// Time coverage is updated once all variables are loaded
+		vecFileVarIx.push_back(sVarIndex);
+	}
+
+	// Update the time coverage of each variable.  Variables that share a
+	// VariableTimeFileMap receive the same entries from this file, so the
+	// map is updated once and stays shared.  It is only copied if some
+	// of the variables sharing it do not appear in this file.  Variables
+	// with empty maps (new variables) start sharing a new map.
+	typedef std::pair<const VariableTimeFileMap *, bool> TimeFileMapKey;
+
+	std::vector<TimeFileMapKey> vecFileVarKeys(vecFileVarIx.size());
+	std::map<TimeFileMapKey, long> mapTimeFileMapRefs;
+	for (size_t i = 0; i < vecFileVarIx.size(); i++) {
+		const VariableInfo & info = *(m_vecVariableInfo[vecFileVarIx[i]]);
+
+		vecFileVarKeys[i].first = NULL;
+		if (info.m_pmapTimeFile->GetCount() != 0) {
+			vecFileVarKeys[i].first = info.m_pmapTimeFile.get();
+		}
+		vecFileVarKeys[i].second = (info.m_iTimeDimIx != (-1));
+
+		mapTimeFileMapRefs[vecFileVarKeys[i]]++;
+	}
+
+	std::map<TimeFileMapKey, std::shared_ptr<VariableTimeFileMap> >
+		mapUpdatedTimeFileMaps;
+
+	for (size_t i = 0; i < vecFileVarIx.size(); i++) {
+		VariableInfo & info = *(m_vecVariableInfo[vecFileVarIx[i]]);
+		const std::string & strVariableName = info.m_strName;
+		const bool fHasTime = (info.m_iTimeDimIx != (-1));
+
+		// No time information on this Variable; only the first file
+		// is recorded
+		if ((!fHasTime) && (info.m_pmapTimeFile->GetCount() != 0)) {
+			LocalFileTimePair filetime;
+			if ((info.m_pmapTimeFile->GetCount() != 1) ||
+			    (!info.m_pmapTimeFile->Find(InvalidTimeIx, filetime))
+			) {
+				return std::string("Variable \"") + strVariableName
+					+ std::string("\" has inconsistent \"time\" dimension across files");
+			}
+			continue;
+		}
+		if (fHasTime && (vecFileTimeIndices.size() == 0)) {
+			continue;
+		}
+
+		// Map already updated for another variable
+		const TimeFileMapKey & key = vecFileVarKeys[i];
+
+		std::map<TimeFileMapKey, std::shared_ptr<VariableTimeFileMap> >::const_iterator
+			iterUpdated = mapUpdatedTimeFileMaps.find(key);
+
+		if (iterUpdated != mapUpdatedTimeFileMaps.end()) {
+			info.m_pmapTimeFile = iterUpdated->second;
+			continue;
+		}
+
+		if (key.first == NULL) {
+			info.m_pmapTimeFile = std::make_shared<VariableTimeFileMap>();
+
+		} else if (info.m_pmapTimeFile.use_count() != mapTimeFileMapRefs[key]) {
+			info.m_pmapTimeFile =
+				std::make_shared<VariableTimeFileMap>(*(info.m_pmapTimeFile));
+		}
+		mapUpdatedTimeFileMaps[key] = info.m_pmapTimeFile;
+
+		VariableTimeFileMap & mapTimeFile = *(info.m_pmapTimeFile);
+
+		// No time information on this Variable
+		if (!fHasTime) {
+			mapTimeFile.Insert(
+				InvalidTimeIx,
+				LocalFileTimePair(f, 0));
+
+		// Add file and time indices to VariableInfo
+		} else {
+			for (int t = 0; t < vecFileTimeIndices.size(); t++) {
+				LocalFileTimePair filetime;
+				if (!mapTimeFile.Find(vecFileTimeIndices[t], filetime)) {
+					mapTimeFile.Insert(
+						vecFileTimeIndices[t],
+						LocalFileTimePair(f, t));
+
+				} else {
+					return std::string("Variable \"") + strVariableName
+						+ std::string("\" has repeated time across files:\n")
+						+ std::string("Time: ") + m_timeaxis.GetTime(vecFileTimeIndices[t]).ToString() + std::string("\n")
+						+ std::string("File1: ") + m_filenames.Get(filetime.first) + std::string("\n")
+						+ std::string("File2: ") + m_filenames.Get(f);
+				}
+			}
+		}
+	}
 
 	return std::string("");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Split a line of a CSV file written by OutputTimeVariableIndexCSV
+///		into fields.
+///	</summary>
+static void SplitCSVLine(
+	const std::string & strLine,
+	std::vector<std::string> & vecFields
+) {
+	vecFields.clear();
+
+	size_t sBegin = 0;
+	for (;;) {
+		size_t sComma = strLine.find(',', sBegin);
+		if (sComma == std::string::npos) {
+			vecFields.push_back(strLine.substr(sBegin));
+			break;
+		}
+		vecFields.push_back(strLine.substr(sBegin, sComma - sBegin));
+		sBegin = sComma + 1;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 std::string FileListObject::OutputTimeVariableIndexCSV(
 	const std::string & strCSVOutputFilename
 ) {
@@ -2091,10 +3093,6 @@ std::string FileListObject::OutputTimeVariableIndexCSV(
 	}
 #endif
 
-	if (m_vecTimes.size() != m_mapTimeToIndex.size()) {
-		_EXCEPTIONT("vecTimes / mapTimeToIndex mismatch");
-	}
-
 	std::vector< std::pair<size_t,int> > iTimeVariableIndex;
 	iTimeVariableIndex.resize(m_vecVariableInfo.size());
 
@@ -2122,22 +3120,58 @@ std::string FileListObject::OutputTimeVariableIndexCSV(
 	}
 	ofOutput << std::endl;
 
-	// Output variables with time dimension
-	for (size_t t = 0; t < m_vecTimes.size(); t++) {
-		ofOutput << m_vecTimes[t].ToString();
+	// Output variables with time dimension.  Each distinct time coverage
+	// is evaluated once per time, and times are visited in order so each
+	// coverage keeps a cursor into its VariableTimeFileMap segments.
+	std::vector<const VariableTimeFileMap *> vecTimeFileMaps;
+	std::vector<size_t> vecVarTimeFileMapIx(m_vecVariableInfo.size());
+	for (size_t v = 0; v < m_vecVariableInfo.size(); v++) {
+		const VariableTimeFileMap * pmapTimeFile =
+			m_vecVariableInfo[v]->m_pmapTimeFile.get();
 
-		for (size_t v = 0; v < m_vecVariableInfo.size(); v++) {
+		size_t i = 0;
+		for (; i < vecTimeFileMaps.size(); i++) {
+			if (vecTimeFileMaps[i] == pmapTimeFile) {
+				break;
+			}
+		}
+		if (i == vecTimeFileMaps.size()) {
+			vecTimeFileMaps.push_back(pmapTimeFile);
+		}
+		vecVarTimeFileMapIx[v] = i;
+	}
+
+	std::vector<size_t> vecSegmentIx(vecTimeFileMaps.size(), 0);
+	std::vector<std::string> vecCells(vecTimeFileMaps.size());
+
+	for (size_t t = 0; t < m_timeaxis.GetCount(); t++) {
+		ofOutput << m_timeaxis.GetTime(t).ToString();
 
-			VariableTimeFileMap::const_iterator iterTimeFile =
-				m_vecVariableInfo[v]->m_mapTimeFile.find(t);
+		for (size_t i = 0; i < vecTimeFileMaps.size(); i++) {
+			const std::vector<VariableTimeFileMap::Segment> & vecSegments =
+				vecTimeFileMaps[i]->GetSegments();
 
-			if (iterTimeFile == m_vecVariableInfo[v]->m_mapTimeFile.end()) {
-				ofOutput << ",";
+			size_t & s = vecSegmentIx[i];
+			while ((s < vecSegments.size()) &&
+			       (vecSegments[s].m_sTimeBegin + vecSegments[s].m_sCount <= t)
+			) {
+				s++;
+			}
+
+			if ((s == vecSegments.size()) || (vecSegments[s].m_sTimeBegin > t)) {
+				vecCells[i] = "";
 			} else {
-				ofOutput << "," << iterTimeFile->second.first
-					<< ":" << iterTimeFile->second.second;
+				vecCells[i] =
+					std::to_string(vecSegments[s].m_sFile)
+					+ std::string(":")
+					+ std::to_string(vecSegments[s].m_iLocalTimeBegin
+						+ static_cast<int>(t - vecSegments[s].m_sTimeBegin));
 			}
 		}
+
+		for (size_t v = 0; v < m_vecVariableInfo.size(); v++) {
+			ofOutput << "," << vecCells[vecVarTimeFileMapIx[v]];
+		}
 		ofOutput << std::endl;
 	}
 
@@ -2145,8 +3179,11 @@ std::string FileListObject::OutputTimeVariableIndexCSV(
 	ofOutput << std::endl << std::endl;
 
 	ofOutput << "file_ix,filename" << std::endl;
-	for (size_t f = 0; f < m_vecFilenames.size(); f++) {
-		ofOutput << f << ",\"" << m_strBaseDir << m_vecFilenames[f] << "\"" << std::endl;
+	for (size_t f = 0; f < m_filenames.GetCount(); f++) {
+		ofOutput << f << ",\""
+			<< m_strBaseDir
+			<< m_filenames.GetDirectory(f)
+			<< m_filenames.GetBasename(f) << "\"" << std::endl;
 	}
 
 	return ("");
@@ -2154,9 +3191,267 @@ std::string FileListObject::OutputTimeVariableIndexCSV(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+std::string FileListObject::LoadTimeVariableIndexCSV(
+	const std::string & strCSVInputFilename
+) {
+	// Check if already initialized
+	if (m_filenames.GetCount() != 0) {
+		_EXCEPTIONT("FileListObject has already been initialized");
+	}
+
+	std::ifstream ifInput(strCSVInputFilename.c_str());
+	if (!ifInput.is_open()) {
+		return std::string("Unable to open input file \"")
+			+ strCSVInputFilename + "\"";
+	}
+
+	std::string strErrorMalformed =
+		std::string("Malformed index file \"")
+		+ strCSVInputFilename + std::string("\"");
+
+	std::string strLine;
+	std::vector<std::string> vecFields;
+
+	// Variables across header
+	std::vector<std::string> vecVariableNames;
+	std::getline(ifInput, strLine);
+	SplitCSVLine(strLine, vecFields);
+	if ((vecFields.size() == 0) || (vecFields[0] != "time")) {
+		return strErrorMalformed;
+	}
+	vecVariableNames.assign(vecFields.begin()+1, vecFields.end());
+
+	// Variables with no time dimension
+	std::vector<bool> vecNoTime;
+	std::getline(ifInput, strLine);
+	SplitCSVLine(strLine, vecFields);
+	if ((vecFields.size() != vecVariableNames.size()+1) ||
+	    (vecFields[0] != "NONE")
+	) {
+		return strErrorMalformed;
+	}
+	for (size_t v = 0; v < vecVariableNames.size(); v++) {
+		vecNoTime.push_back(vecFields[v+1] == "X");
+	}
+
+	// Variables with time dimension
+	std::vector<std::string> vecTimeStrings;
+	std::vector< std::vector<std::string> > vecTimeFileCells;
+	for (;;) {
+		if (!std::getline(ifInput, strLine)) {
+			return strErrorMalformed;
+		}
+		if (strLine == "") {
+			break;
+		}
+		SplitCSVLine(strLine, vecFields);
+		if (vecFields.size() != vecVariableNames.size()+1) {
+			return strErrorMalformed;
+		}
+		vecTimeStrings.push_back(vecFields[0]);
+		vecTimeFileCells.push_back(
+			std::vector<std::string>(vecFields.begin()+1, vecFields.end()));
+	}
+
+	// File names
+	while (std::getline(ifInput, strLine)) {
+		if (strLine == "") {
+			continue;
+		}
+		if (strLine == "file_ix,filename") {
+			continue;
+		}
+
+		size_t sComma = strLine.find(',');
+		if (sComma == std::string::npos) {
+			return strErrorMalformed;
+		}
+
+		size_t sFileIx = atol(strLine.substr(0, sComma).c_str());
+		if (sFileIx != m_filenames.GetCount()) {
+			return strErrorMalformed;
+		}
+
+		std::string strFilename = strLine.substr(sComma+1);
+		if ((strFilename.length() >= 2) &&
+		    (strFilename[0] == '\"') &&
+		    (strFilename[strFilename.length()-1] == '\"')
+		) {
+			strFilename = strFilename.substr(1, strFilename.length()-2);
+		}
+		m_filenames.Add(strFilename);
+	}
+
+	// Filenames in the index are stored with their full path
+	m_strBaseDir = "";
+
+	// Decode the time-file map
+	std::vector< std::vector<LocalFileTimePair> >
+		vecTimeFilePairs(vecTimeStrings.size());
+
+	for (size_t t = 0; t < vecTimeStrings.size(); t++) {
+		vecTimeFilePairs[t].resize(
+			vecVariableNames.size(),
+			LocalFileTimePair(InvalidFileIx, 0));
+
+		for (size_t v = 0; v < vecVariableNames.size(); v++) {
+			const std::string & strCell = vecTimeFileCells[t][v];
+			if (strCell == "") {
+				continue;
+			}
+
+			size_t sColon = strCell.find(':');
+			if (sColon == std::string::npos) {
+				return strErrorMalformed;
+			}
+
+			size_t sFileIx = atol(strCell.substr(0, sColon).c_str());
+			int iLocalTimeIx = atoi(strCell.substr(sColon+1).c_str());
+			if (sFileIx >= m_filenames.GetCount()) {
+				return strErrorMalformed;
+			}
+
+			vecTimeFilePairs[t][v] = LocalFileTimePair(sFileIx, iLocalTimeIx);
+		}
+	}
+
+	Time::CalendarType eCalendarType = Time::CalendarStandard;
+	bool fHasCalendarType = false;
+
+	std::string strError;
+
+	// Metadata (attributes, dimensions, units and calendar) is not stored
+	// in the index, so rescan files in order until every variable in the
+	// index has been found.  Each variable is then defined by the first
+	// file that contains it, as in a full scan, whether or not it has a
+	// time dimension.  Files after the last such file are not checked
+	// for consistency.
+	for (size_t f = 0; f < m_filenames.GetCount(); f++) {
+
+		// The first file is always scanned for global attributes
+		if (f != 0) {
+			bool fAllFound = true;
+			for (size_t v = 0; v < vecVariableNames.size(); v++) {
+				if (GetVariableInfo(vecVariableNames[v]) == NULL) {
+					fAllFound = false;
+					break;
+				}
+			}
+			if (fAllFound) {
+				break;
+			}
+		}
+
+		FileSummary filesum;
+		filesum.FromFile(m_filenames.Get(f), m_strRecordDimName);
+
+		strError = IndexFileSummary(f, filesum);
+		if (strError != "") return strError;
+
+		if ((!fHasCalendarType) && (filesum.m_fHasTimeVariable)) {
+			eCalendarType = filesum.m_eTimeCalendar;
+			fHasCalendarType = true;
+		}
+	}
+
+	// Replace the time-file map with the one in the index
+	m_timeaxis.Clear();
+
+	for (size_t t = 0; t < vecTimeStrings.size(); t++) {
+		Time time(eCalendarType);
+		time.FromFormattedString(vecTimeStrings[t]);
+
+		bool fInserted;
+		m_timeaxis.Insert(time, fInserted);
+		if (!fInserted) {
+			return std::string("Repeated time \"") + vecTimeStrings[t]
+				+ std::string("\" in index file \"")
+				+ strCSVInputFilename + std::string("\"");
+		}
+	}
+
+	// Variables are kept in the order they appear in the index
+	std::vector<VariableInfo *> vecVariableInfo;
+	std::vector<bool> vecVariableInfoUsed(m_vecVariableInfo.size(), false);
+	for (size_t v = 0; v < vecVariableNames.size(); v++) {
+		size_t sVarIndex = FindVariableInfoIx(vecVariableNames[v]);
+		if ((sVarIndex == m_vecVariableInfo.size()) ||
+		    (vecVariableInfoUsed[sVarIndex])
+		) {
+			return std::string("Variable \"") + vecVariableNames[v]
+				+ std::string("\" in index file \"")
+				+ strCSVInputFilename
+				+ std::string("\" not found in any indexed file");
+		}
+		vecVariableInfoUsed[sVarIndex] = true;
+		vecVariableInfo.push_back(m_vecVariableInfo[sVarIndex]);
+	}
+	for (size_t i = 0; i < m_vecVariableInfo.size(); i++) {
+		if (!vecVariableInfoUsed[i]) {
+			vecVariableInfo.push_back(m_vecVariableInfo[i]);
+		}
+	}
+	m_vecVariableInfo = vecVariableInfo;
+	for (size_t i = 0; i < m_vecVariableInfo.size(); i++) {
+		m_mapVariableInfoIx[m_vecVariableInfo[i]->m_strName] = i;
+	}
+
+	for (size_t v = 0; v < vecVariableNames.size(); v++) {
+		VariableInfo * pvarinfo = m_vecVariableInfo[v];
+
+		if (vecNoTime[v] != (pvarinfo->m_iTimeDimIx == (-1))) {
+			return std::string("Variable \"") + vecVariableNames[v]
+				+ std::string("\" has inconsistent \"time\" dimension with index file \"")
+				+ strCSVInputFilename + std::string("\"");
+		}
+
+		if (vecNoTime[v]) {
+			continue;
+		}
+
+		pvarinfo->m_pmapTimeFile = std::make_shared<VariableTimeFileMap>();
+		for (size_t t = 0; t < vecTimeStrings.size(); t++) {
+			if (vecTimeFilePairs[t][v].first != InvalidFileIx) {
+				pvarinfo->m_pmapTimeFile->Insert(
+					t, vecTimeFilePairs[t][v]);
+			}
+		}
+	}
+
+	// Sort times and update dimension information
+	FinalizeIndex();
+
+	return std::string("");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Get the CDML datatype of an attribute value.
+///	</summary>
+static std::string AttributeDatatypeString(
+	const AttributeValue & attvalue
+) {
+	if (attvalue.GetType() == ncChar) {
+		return std::string("String");
+	}
+	return NcTypeToString(attvalue.GetType());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 std::string FileListObject::OutputTimeVariableIndexXML(
 	const std::string & strXMLOutputFilename
 ) {
+#if defined(HYPERION_MPIOMP)
+	// Only output on root thread
+	int nRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+	if (nRank != 0) {
+		return std::string("");
+	}
+#endif
+
 	using namespace tinyxml2;
 	/*
 	XMLDocument xmlDoc;
@@ -2179,7 +3474,9 @@ std::string FileListObject::OutputTimeVariableIndexXML(
 		AttributeMap::const_iterator iterAttKey =
 			m_datainfo.m_mapKeyAttributes.begin();
 		for (; iterAttKey != m_datainfo.m_mapKeyAttributes.end(); iterAttKey++) {
-			pdata->SetAttribute(iterAttKey->first.c_str(), iterAttKey->second.c_str());
+			pdata->SetAttribute(
+				iterAttKey->first.c_str(),
+				iterAttKey->second.ToString().c_str());
 		}
 
 		AttributeMap::const_iterator iterAttOther =
@@ -2187,8 +3484,9 @@ std::string FileListObject::OutputTimeVariableIndexXML(
 		for (; iterAttOther != m_datainfo.m_mapOtherAttributes.end(); iterAttOther++) {
 			tinyxml2::XMLElement * pattr = xmlDoc.NewElement("attr");
 			pattr->SetAttribute("name", iterAttOther->first.c_str());
-			pattr->SetAttribute("datatype", "String");
-			pattr->SetText(iterAttOther->second.c_str());
+			pattr->SetAttribute("datatype",
+				AttributeDatatypeString(iterAttOther->second).c_str());
+			pattr->SetText(iterAttOther->second.ToString().c_str());
 			pdata->InsertEndChild(pattr);
 		}
 	}
@@ -2198,16 +3496,28 @@ std::string FileListObject::OutputTimeVariableIndexXML(
 	for (int d = 0; d < m_vecDimensionInfo.size(); d++) {
 		const DimensionInfo * pdiminfo = m_vecDimensionInfo[d];
 
+		// The record axis spans all files
+		bool fRecordAxis =
+			(pdiminfo->m_strName == m_strRecordDimName) &&
+			(m_timeaxis.GetCount() != 0);
+
+		int64_t iLength = (int64_t)pdiminfo->m_lSize;
+		if (fRecordAxis) {
+			iLength = (int64_t)m_timeaxis.GetCount();
+		}
+
 		tinyxml2::XMLElement * pdim = xmlDoc.NewElement("axis");
 		pdim->SetAttribute("id", pdiminfo->m_strName.c_str());
 		pdim->SetAttribute("units", pdiminfo->m_strUnits.c_str());
-		pdim->SetAttribute("length", (int64_t)pdiminfo->m_lSize);
+		pdim->SetAttribute("length", iLength);
 		pdim->SetAttribute("datatype", NcTypeToString(pdiminfo->m_nctype).c_str());
 
 		AttributeMap::const_iterator iterAttKey =
 			pdiminfo->m_mapKeyAttributes.begin();
 		for (; iterAttKey != pdiminfo->m_mapKeyAttributes.end(); iterAttKey++) {
-			pdim->SetAttribute(iterAttKey->first.c_str(), iterAttKey->second.c_str());
+			pdim->SetAttribute(
+				iterAttKey->first.c_str(),
+				iterAttKey->second.ToString().c_str());
 		}
 
 		AttributeMap::const_iterator iterAttOther =
@@ -2215,11 +3525,58 @@ std::string FileListObject::OutputTimeVariableIndexXML(
 		for (; iterAttOther != pdiminfo->m_mapOtherAttributes.end(); iterAttOther++) {
 			tinyxml2::XMLElement * pattr = xmlDoc.NewElement("attr");
 			pattr->SetAttribute("name", iterAttOther->first.c_str());
-			pattr->SetAttribute("datatype", "String");
-			pattr->SetText(iterAttOther->second.c_str());
+			pattr->SetAttribute("datatype",
+				AttributeDatatypeString(iterAttOther->second).c_str());
+			pattr->SetText(iterAttOther->second.ToString().c_str());
 			pdim->InsertEndChild(pattr);
 		}
 
+		// Record axis values are taken from the TimeAxis; a regular
+		// axis is written as a linear axis (as cdscan -i)
+		if (fRecordAxis) {
+			std::string strUnits = pdiminfo->m_strUnits;
+			if (strUnits == "") {
+				strUnits = m_strTimeUnits;
+			}
+
+			size_t sTimeCount = m_timeaxis.GetCount();
+
+			if ((m_timeaxis.GetSegmentCount() == 1) && (sTimeCount > 1)) {
+				double dStart =
+					m_timeaxis.GetTime(0).GetCFCompliantUnitsOffsetDouble(strUnits);
+				double dDelta =
+					m_timeaxis.GetTime(1).GetCFCompliantUnitsOffsetDouble(strUnits)
+					- dStart;
+
+				tinyxml2::XMLElement * plinear = xmlDoc.NewElement("linear");
+				plinear->SetAttribute("delta", dDelta);
+				plinear->SetAttribute("length", iLength);
+				plinear->SetAttribute("start", dStart);
+				pdim->InsertEndChild(plinear);
+
+			} else {
+				std::ostringstream ssText;
+				if (pdiminfo->m_nctype == ncFloat) {
+					ssText << std::setprecision(8);
+				} else {
+					ssText << std::setprecision(17);
+				}
+				ssText << "[";
+				for (size_t t = 0; t < sTimeCount; t++) {
+					ssText << m_timeaxis.GetTime(t).GetCFCompliantUnitsOffsetDouble(strUnits);
+					if (t != sTimeCount-1) {
+						ssText << " ";
+					}
+				}
+				ssText << "]";
+
+				pdim->SetText(ssText.str().c_str());
+			}
+
+			pdata->InsertEndChild(pdim);
+			continue;
+		}
+
 		bool fHasValues = false;
 		if ((pdiminfo->m_nctype == ncDouble) && (pdiminfo->m_dValuesDouble.size() != 0)) {
 			fHasValues = true;
@@ -2275,7 +3632,9 @@ std::string FileListObject::OutputTimeVariableIndexXML(
 		AttributeMap::const_iterator iterAttKey =
 			pvarinfo->m_mapKeyAttributes.begin();
 		for (; iterAttKey != pvarinfo->m_mapKeyAttributes.end(); iterAttKey++) {
-			pvar->SetAttribute(iterAttKey->first.c_str(), iterAttKey->second.c_str());
+			pvar->SetAttribute(
+				iterAttKey->first.c_str(),
+				iterAttKey->second.ToString().c_str());
 		}
 
 		AttributeMap::const_iterator iterAttOther =
@@ -2283,8 +3642,9 @@ std::string FileListObject::OutputTimeVariableIndexXML(
 		for (; iterAttOther != pvarinfo->m_mapOtherAttributes.end(); iterAttOther++) {
 			tinyxml2::XMLElement * pattr = xmlDoc.NewElement("attr");
 			pattr->SetAttribute("name", iterAttOther->first.c_str());
-			pattr->SetAttribute("datatype", "String");
-			pattr->SetText(iterAttOther->second.c_str());
+			pattr->SetAttribute("datatype",
+				AttributeDatatypeString(iterAttOther->second).c_str());
+			pattr->SetText(iterAttOther->second.ToString().c_str());
 			pvar->InsertEndChild(pattr);
 		}
 
@@ -20,10 +20,20 @@
 #include "Announce.h"
 #include "Object.h"
 #include "TimeObj.h"
+#include "TimeAxis.h"
 #include "DataArray1D.h"
 #include "GlobalFunction.h"
+#include "StringPool.h"
+#include "FileSummary.h"
+#include "FileSummaryCache.h"
+#include "FilenameTable.h"
+#include "NcFileCache.h"
 #include "netcdfcpp.h"
 
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
 ///////////////////////////////////////////////////////////////////////////////
 
 class RecapConfigObject;
@@ -40,14 +50,132 @@ class Variable;
 typedef std::pair<size_t, int> LocalFileTimePair;
 
 ///	<summary>
-///		A map from time indices to local (file,time) pairs.
+///		A map from time indices to local (file,time) pairs, stored as
+///		sorted runs of consecutive time indices that map to consecutive
+///		local times in one file.  A variable that spans many files needs
+///		one run per file rather than one entry per time.
 ///	</summary>
-typedef std::map<size_t, LocalFileTimePair> VariableTimeFileMap;
+class VariableTimeFileMap {
+
+public:
+	///	<summary>
+	///		Time indices [m_sTimeBegin, m_sTimeBegin + m_sCount) map to
+	///		local times [m_iLocalTimeBegin, m_iLocalTimeBegin + m_sCount)
+	///		of file m_sFile.
+	///	</summary>
+	class Segment {
+	public:
+		///	<summary>
+		///		First time index.
+		///	</summary>
+		size_t m_sTimeBegin;
+
+		///	<summary>
+		///		File index.
+		///	</summary>
+		size_t m_sFile;
+
+		///	<summary>
+		///		First local time index in the file.
+		///	</summary>
+		int m_iLocalTimeBegin;
+
+		///	<summary>
+		///		Number of time indices.
+		///	</summary>
+		size_t m_sCount;
+	};
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	VariableTimeFileMap() :
+		m_sCount(0)
+	{ }
+
+public:
+	///	<summary>
+	///		Remove all entries.
+	///	</summary>
+	void Clear() {
+		m_vecSegments.clear();
+		m_sCount = 0;
+	}
+
+	///	<summary>
+	///		Get the number of time indices in the map.
+	///	</summary>
+	size_t GetCount() const {
+		return m_sCount;
+	}
+
+	///	<summary>
+	///		Get the segments, ordered by time index.
+	///	</summary>
+	const std::vector<Segment> & GetSegments() const {
+		return m_vecSegments;
+	}
+
+	///	<summary>
+	///		Find the local (file,time) pair for the given time index.
+	///		Returns false if the time index is not in the map.
+	///	</summary>
+	bool Find(
+		size_t sTime,
+		LocalFileTimePair & filetime
+	) const;
+
+	///	<summary>
+	///		Add a time index.  Returns false if it is already in the map.
+	///	</summary>
+	bool Insert(
+		size_t sTime,
+		const LocalFileTimePair & filetime
+	);
+
+	///	<summary>
+	///		Equality operator.
+	///	</summary>
+	bool operator==(const VariableTimeFileMap & map) const;
+
+	///	<summary>
+	///		Get a hash of the segments.  Equal maps have equal hashes.
+	///	</summary>
+	size_t GetHash() const;
+
+	///	<summary>
+	///		Replace time indices after TimeAxis::Sort().
+	///	</summary>
+	void Remap(
+		const std::vector<TimeAxis::IndexRun> & vecIndexRuns
+	);
+
+protected:
+	///	<summary>
+	///		Get the index of the first segment with m_sTimeBegin > sTime.
+	///	</summary>
+	size_t UpperBound(
+		size_t sTime
+	) const;
+
+protected:
+	///	<summary>
+	///		Segments, ordered by time index.
+	///	</summary>
+	std::vector<Segment> m_vecSegments;
+
+	///	<summary>
+	///		Number of time indices in the map.
+	///	</summary>
+	size_t m_sCount;
+};
 
 ///	<summary>
-///		A map from attribute names to values.
+///		A map from attribute names to typed values.  Values are formatted
+///		only when the index is written.
 ///	</summary>
-typedef std::map<std::string, std::string> AttributeMap;
+typedef std::map<InternedString, AttributeValue> AttributeMap;
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -61,7 +189,8 @@ public:
 	///		Default constructor.
 	///	</summary>
 	DataObjectInfo() :
-		m_nctype(ncNoType)
+		m_nctype(ncNoType),
+		m_uAttributeFingerprint(0)
 	{ }
 
 	///	<summary>
@@ -71,7 +200,8 @@ public:
 		const std::string & strName
 	) :
 		m_strName(strName),
-		m_nctype(ncNoType)
+		m_nctype(ncNoType),
+		m_uAttributeFingerprint(0)
 	{ }
 
 public:
@@ -88,10 +218,28 @@ public:
 	///		Populate from a NcVar.
 	///	</summary>
 	std::string FromNcVar(
+		NcFile * ncfile,
 		NcVar * var,
 		bool fCheckConsistency
 	);
 
+	///	<summary>
+	///		Populate from the global attributes in a FileSummary.
+	///	</summary>
+	std::string FromFileSummary(
+		const DataObjectSummary & datasum,
+		bool fCheckConsistency,
+		const std::string & strFilename
+	);
+
+	///	<summary>
+	///		Populate from a variable in a FileSummary.
+	///	</summary>
+	std::string FromVariableSummary(
+		const DataObjectSummary & datasum,
+		bool fCheckConsistency
+	);
+
 public:
 	///	<summary>
 	///		Equality operator.
@@ -138,6 +286,13 @@ public:
 	///	</summary>
 	AttributeMap m_mapOtherAttributes;
 
+	///	<summary>
+	///		Fingerprint of the first attribute set used to populate the
+	///		attribute maps.  Files with the same fingerprint are known to
+	///		be consistent without comparing attributes one by one.
+	///	</summary>
+	uint64_t m_uAttributeFingerprint;
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -157,9 +312,23 @@ public:
 		DataObjectInfo(strName),
 		m_iTimeDimIx(-1),
 		m_iVerticalDimIx(-1),
-		m_nVerticalDimOrder(+1)
+		m_nVerticalDimOrder(+1),
+		m_pmapTimeFile(new VariableTimeFileMap)
 	{ } 
 
+public:
+	///	<summary>
+	///		Get the VariableTimeFileMap of this variable for modification,
+	///		first copying it if it is shared with another variable.
+	///	</summary>
+	VariableTimeFileMap & GetUniqueTimeFileMap() {
+		if (m_pmapTimeFile.use_count() != 1) {
+			m_pmapTimeFile =
+				std::make_shared<VariableTimeFileMap>(*m_pmapTimeFile);
+		}
+		return (*m_pmapTimeFile);
+	}
+
 public:
 	///	<summary>
 	///		Index of time dimension or (-1) if time dimension doesn't exist.
@@ -179,7 +348,7 @@ public:
 	///	<summary>
 	///		Dimension names.
 	///	</summary>
-	std::vector<std::string> m_vecDimNames;
+	std::vector<InternedString> m_vecDimNames;
 
 	///	<summary>
 	///		Size of each dimension.
@@ -197,9 +366,11 @@ public:
 	std::vector<long> m_vecAuxDimSizes;
 
 	///	<summary>
-	///		Map from Times to filename index and time index.
+	///		Map from Times to filename index and time index.  Variables
+	///		with the same time coverage share one map, which is copied
+	///		before it is modified for only some of them.
 	///	</summary>
-	VariableTimeFileMap m_mapTimeFile;
+	std::shared_ptr<VariableTimeFileMap> m_pmapTimeFile;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -389,14 +560,13 @@ public:
 		Object(strName),
 		m_pobjRecapConfig(NULL),
 		m_strRecordDimName("time"),
+		m_nThreads(1),
+		m_pcache(NULL),
+		m_ncfcacheRead(NcFile::ReadOnly),
+		m_ncfcacheWrite(NcFile::Write),
 		m_sReduceTargetIx(InvalidFileIx)
 	{ }
 
-	///	<summary>
-	///		Destructor.
-	///	</summary>
-	~FileListObject();
-
 	///	<summary>
 	///		Call a member function of this Object.
 	///	</summary>
@@ -417,22 +587,43 @@ public:
 		m_pobjRecapConfig = pobjRecapConfig;
 	}
 
+	///	<summary>
+	///		Set the number of threads used to read file metadata.  Files
+	///		opened through libnetcdf (netCDF-4) are still parsed one at
+	///		a time; only the read-ahead of their contents overlaps.
+	///	</summary>
+	void SetThreadCount(
+		int nThreads
+	) {
+		m_nThreads = nThreads;
+	}
+
+	///	<summary>
+	///		Set the cache used to avoid reopening unchanged files.  The
+	///		cache is not owned by this FileListObject.
+	///	</summary>
+	void SetFileSummaryCache(
+		FileSummaryCache * pcache
+	) {
+		m_pcache = pcache;
+	}
+
 public:
 	///	<summary>
 	///		Get the count of filenames.
 	///	</summary>
 	size_t GetFilenameCount() const {
-		return m_vecFilenames.size();
+		return m_filenames.GetCount();
 	}
 
 	///	<summary>
-	///		Get the vector of filenames.
+	///		Get the filename with the given index.
 	///	</summary>
-	const std::string & GetFilename(size_t f) const {
-		if (f >= m_vecFilenames.size()) {
+	std::string GetFilename(size_t f) const {
+		if (f >= m_filenames.GetCount()) {
 			_EXCEPTIONT("Index out of range");
 		}
-		return m_vecFilenames[f];
+		return m_filenames.Get(f);
 	}
 
 	///	<summary>
@@ -441,21 +632,31 @@ public:
 	const VariableInfo * GetVariableInfo(
 		const std::string & strVariableName
 	) const {
-		for (size_t i = 0; i < m_vecVariableInfo.size(); i++) {
-			if (m_vecVariableInfo[i]->m_strName == strVariableName) {
-				return (m_vecVariableInfo[i]);
-			}
+		size_t sVarIndex = FindVariableInfoIx(strVariableName);
+		if (sVarIndex == m_vecVariableInfo.size()) {
+			return NULL;
 		}
-		return NULL;
+		return (m_vecVariableInfo[sVarIndex]);
 	}
 
 	///	<summary>
-	///		Populate from a search string.
+	///		Populate from a search string.  If the FileListObject has
+	///		already been populated, files that are not yet indexed are
+	///		appended.
 	///	</summary>
 	std::string PopulateFromSearchString(
 		const std::string & strSearchString
 	);
 
+	///	<summary>
+	///		Populate from a list of paths, one per line or separated by
+	///		NUL characters, read from the given file or from standard
+	///		input if the filename is "-".  Paths are stored as given.
+	///	</summary>
+	std::string PopulateFromFileList(
+		const std::string & strFileList
+	);
+
 	///	<summary>
 	///		Add a series of files with the given filename template.
 	///	</summary>
@@ -502,24 +703,21 @@ public:
 	///		Get the number of time indices in the file list.
 	///	</summary>
 	size_t GetTimeCount() const {
-		return m_vecTimes.size();
+		return m_timeaxis.GetCount();
 	}
 
 	///	<summary>
 	///		Get the Time with the specified index.
 	///	</summary>
-	const Time & GetTime(int iTime) const {
-		if (iTime >= m_vecTimes.size()) {
-			_EXCEPTIONT("Out of range");
-		}
-		return m_vecTimes[iTime];
+	Time GetTime(size_t sTime) const {
+		return m_timeaxis.GetTime(sTime);
 	}
 
 	///	<summary>
-	///		Get the vector of Times associated with the FileList.
+	///		Get the TimeAxis associated with the FileList.
 	///	</summary>
-	const std::vector<Time> & GetTimes() const {
-		return m_vecTimes;
+	const TimeAxis & GetTimeAxis() const {
+		return m_timeaxis;
 	}
 
 	///	<summary>
@@ -631,19 +829,114 @@ public:
 
 protected:
 	///	<summary>
-	///		Sort the array of Times to keep m_vecTimes in
+	///		Get the index of the VariableInfo with the given name, or
+	///		m_vecVariableInfo.size() if there is none.
+	///	</summary>
+	size_t FindVariableInfoIx(
+		const std::string & strVariableName
+	) const {
+		std::unordered_map<std::string, size_t>::const_iterator iter =
+			m_mapVariableInfoIx.find(strVariableName);
+		if (iter == m_mapVariableInfoIx.end()) {
+			return m_vecVariableInfo.size();
+		}
+		return iter->second;
+	}
+
+	///	<summary>
+	///		Get the index of the DimensionInfo with the given name, or
+	///		m_vecDimensionInfo.size() if there is none.
+	///	</summary>
+	size_t FindDimensionInfoIx(
+		const std::string & strDimName
+	) const {
+		std::unordered_map<std::string, size_t>::const_iterator iter =
+			m_mapDimensionInfoIx.find(strDimName);
+		if (iter == m_mapDimensionInfoIx.end()) {
+			return m_vecDimensionInfo.size();
+		}
+		return iter->second;
+	}
+
+	///	<summary>
+	///		Append a new VariableInfo to m_vecVariableInfo.
+	///	</summary>
+	void AddVariableInfo(
+		const std::string & strVariableName
+	) {
+		m_deqVariableInfo.emplace_back(strVariableName);
+		m_mapVariableInfoIx[strVariableName] = m_vecVariableInfo.size();
+		m_vecVariableInfo.push_back(&(m_deqVariableInfo.back()));
+	}
+
+	///	<summary>
+	///		Append a new DimensionInfo to m_vecDimensionInfo.
+	///	</summary>
+	void AddDimensionInfo(
+		const std::string & strDimName
+	) {
+		m_deqDimensionInfo.emplace_back(strDimName);
+		m_mapDimensionInfoIx[strDimName] = m_vecDimensionInfo.size();
+		m_vecDimensionInfo.push_back(&(m_deqDimensionInfo.back()));
+	}
+
+	///	<summary>
+	///		Sort the TimeAxis to keep time indices in
 	///		chronological order.
 	///	</summary>
 	void SortTimeArray();
 
 	///	<summary>
-	///		Index variable data.
+	///		Index variable data.  Under MPI the files are distributed
+	///		across ranks and the index is assembled on every rank.
 	///	</summary>
 	std::string IndexVariableData(
 		size_t sFileIxBegin = InvalidFileIx,
 		size_t sFileIxEnd = InvalidFileIx
 	);
 
+#if defined(HYPERION_MPIOMP)
+	///	<summary>
+	///		Index variable data with files split evenly across MPI ranks.
+	///		Summaries are gathered on rank 0 and broadcast, so every rank
+	///		merges the full index and returns the same status.
+	///	</summary>
+	std::string IndexVariableDataDistributed(
+		size_t sFileIxBegin,
+		size_t sFileIxEnd
+	);
+#endif
+
+	///	<summary>
+	///		Get the keys used to cache the given range of files.
+	///	</summary>
+	void GetCacheKeys(
+		size_t sFileIxBegin,
+		size_t sFileIxEnd,
+		std::vector<std::string> & vecCacheKeys
+	) const;
+
+	///	<summary>
+	///		Merge the FileSummary of file f into the index.  Summaries
+	///		must be merged in file order and followed by FinalizeIndex().
+	///	</summary>
+	std::string IndexFileSummary(
+		size_t f,
+		const FileSummary & filesum
+	);
+
+	///	<summary>
+	///		Make variables with identical time coverage share one
+	///		VariableTimeFileMap.
+	///	</summary>
+	void ShareTimeFileMaps();
+
+	///	<summary>
+	///		Sort the array of Times and update the time and auxiliary
+	///		dimension sizes of all variables after merging.
+	///	</summary>
+	void FinalizeIndex();
+
 public:
 	///	<summary>
 	///		Output the time-variable index as a CSV.
@@ -652,6 +945,15 @@ public:
 		const std::string & strCSVOutput
 	);
 
+	///	<summary>
+	///		Load a time-variable index written by OutputTimeVariableIndexCSV
+	///		so that new files can be appended without rescanning the old
+	///		ones.  Only the files needed to recover metadata are opened.
+	///	</summary>
+	std::string LoadTimeVariableIndexCSV(
+		const std::string & strCSVInput
+	);
+
 	///	<summary>
 	///		Output the time-variable index as a XML.
 	///	</summary>
@@ -682,15 +984,40 @@ protected:
 	///	</summary>
 	std::string m_strRecordDimName;
 
+	///	<summary>
+	///		Number of threads used to read file metadata.
+	///	</summary>
+	int m_nThreads;
+
+	///	<summary>
+	///		Cache of per-file metadata (or NULL).
+	///	</summary>
+	FileSummaryCache * m_pcache;
+
+	///	<summary>
+	///		Files kept open by LoadData_float().
+	///	</summary>
+	NcFileCache m_ncfcacheRead;
+
+	///	<summary>
+	///		Files kept open by WriteData_float().
+	///	</summary>
+	NcFileCache m_ncfcacheWrite;
+
 	///	<summary>
 	///		The base directory.
 	///	</summary>
 	std::string m_strBaseDir;
 
 	///	<summary>
-	///		The list of filenames.
+	///		The list of filenames, relative to m_strBaseDir.
+	///	</summary>
+	FilenameTable m_filenames;
+
+	///	<summary>
+	///		Buffer used to assemble full paths of files.
 	///	</summary>
-	std::vector<std::string> m_vecFilenames;
+	std::string m_strFullFilename;
 
 	///	<summary>
 	///		The format of the record variable.
@@ -698,15 +1025,18 @@ protected:
 	std::string m_strTimeUnits;
 
 	///	<summary>
-	///		The list of Times that appear in the FileList
-	///		(in chronological order).
+	///		The Times that appear in the FileList (in chronological
+	///		order), stored as regular segments.  All Times in the
+	///		FileList share the same calendar.
 	///	</summary>
-	std::vector<Time> m_vecTimes;
+	TimeAxis m_timeaxis;
 
 	///	<summary>
-	///		A map from Time to m_vecTimes vector index
+	///		Storage for the VariableInfo in m_vecVariableInfo.  Elements
+	///		of a deque are not moved as it grows and are allocated and
+	///		freed in blocks.
 	///	</summary>
-	std::map<Time, size_t> m_mapTimeToIndex;
+	std::deque<VariableInfo> m_deqVariableInfo;
 
 	///	<summary>
 	///		Information on variables that appear in the FileList.
@@ -714,10 +1044,25 @@ protected:
 	std::vector<VariableInfo *> m_vecVariableInfo;
 
 	///	<summary>
-	///		Information on variables that appear in the FileList.
+	///		A map from variable name to m_vecVariableInfo index.
+	///	</summary>
+	std::unordered_map<std::string, size_t> m_mapVariableInfoIx;
+
+	///	<summary>
+	///		Storage for the DimensionInfo in m_vecDimensionInfo.
+	///	</summary>
+	std::deque<DimensionInfo> m_deqDimensionInfo;
+
+	///	<summary>
+	///		Information on dimensions that appear in the FileList.
 	///	</summary>
 	std::vector<DimensionInfo *> m_vecDimensionInfo;
 
+	///	<summary>
+	///		A map from dimension name to m_vecDimensionInfo index.
+	///	</summary>
+	std::unordered_map<std::string, size_t> m_mapDimensionInfoIx;
+
 	///	<summary>
 	///		A set containing dimension information for this FileList.
 	///	</summary>
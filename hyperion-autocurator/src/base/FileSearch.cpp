@@ -0,0 +1,480 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FileSearch.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "FileSearch.h"
+#include "GlobPattern.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <dirent.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		An entry in a directory.
+///	</summary>
+struct DirectoryEntry {
+
+	///	<summary>
+	///		Name of the entry.
+	///	</summary>
+	std::string m_strName;
+
+	///	<summary>
+	///		Flag indicating the entry is (or links to) a directory.
+	///	</summary>
+	bool m_fIsDirectory;
+
+	///	<summary>
+	///		Flag indicating the entry is a symbolic link.
+	///	</summary>
+	bool m_fIsLink;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Read all entries of a directory, excluding "." and "..".
+///	</summary>
+static bool ReadDirectory(
+	const std::string & strDir,
+	std::vector<DirectoryEntry> & vecEntries
+) {
+	vecEntries.clear();
+
+	DIR * pDir = opendir(strDir.c_str());
+	if (pDir == NULL) {
+		return false;
+	}
+
+	struct dirent * pDirent;
+	while ((pDirent = readdir(pDir)) != NULL) {
+		DirectoryEntry entry;
+		entry.m_strName = pDirent->d_name;
+		if ((entry.m_strName == ".") || (entry.m_strName == "..")) {
+			continue;
+		}
+
+		unsigned char dtype = DT_UNKNOWN;
+#if defined(_DIRENT_HAVE_D_TYPE) || defined(__APPLE__)
+		dtype = pDirent->d_type;
+#endif
+
+		// Fall back to stat() if the filesystem does not report the type
+		if ((dtype == DT_UNKNOWN) || (dtype == DT_LNK)) {
+			std::string strPath = strDir + entry.m_strName;
+			struct stat statbuf;
+			if (dtype == DT_UNKNOWN) {
+				if (lstat(strPath.c_str(), &statbuf) == 0) {
+					if (S_ISLNK(statbuf.st_mode)) {
+						dtype = DT_LNK;
+					} else if (S_ISDIR(statbuf.st_mode)) {
+						dtype = DT_DIR;
+					} else {
+						dtype = DT_REG;
+					}
+				}
+			}
+			entry.m_fIsLink = (dtype == DT_LNK);
+			entry.m_fIsDirectory = (dtype == DT_DIR);
+			if (entry.m_fIsLink) {
+				if (stat(strPath.c_str(), &statbuf) == 0) {
+					entry.m_fIsDirectory = S_ISDIR(statbuf.st_mode);
+				}
+			}
+
+		} else {
+			entry.m_fIsLink = false;
+			entry.m_fIsDirectory = (dtype == DT_DIR);
+		}
+
+		vecEntries.push_back(entry);
+	}
+	closedir(pDir);
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A concurrent walk of the directory tree below a root directory,
+///		matching one path component of the search pattern per level.
+///	</summary>
+class DirectoryWalker {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	DirectoryWalker(
+		const std::vector<std::string> & vecComponents
+	) :
+		m_vecComponents(vecComponents),
+		m_vecGlobs(vecComponents.size()),
+		m_nActive(0)
+	{
+		for (size_t i = 0; i < vecComponents.size(); i++) {
+			if (GlobPattern::ContainsWildcard(vecComponents[i])) {
+				m_vecGlobs[i].Compile(vecComponents[i]);
+			}
+		}
+	}
+
+public:
+	///	<summary>
+	///		Find all files below strRootDir that match the pattern.
+	///	</summary>
+	void Run(
+		const std::string & strRootDir,
+		int nThreads,
+		std::vector<std::string> & vecFiles
+	) {
+		m_vecFiles.clear();
+		m_dequeWork.push_back(WorkItem(strRootDir, 0));
+
+		if (nThreads <= 1) {
+			Work();
+
+		} else {
+			std::vector<std::thread> vecThreads;
+			for (int i = 0; i < nThreads; i++) {
+				vecThreads.push_back(
+					std::thread(&DirectoryWalker::Work, this));
+			}
+			for (int i = 0; i < nThreads; i++) {
+				vecThreads[i].join();
+			}
+		}
+
+		vecFiles.swap(m_vecFiles);
+	}
+
+protected:
+	///	<summary>
+	///		A directory and the index of the path component that
+	///		entries of the directory must match.
+	///	</summary>
+	typedef std::pair<std::string, size_t> WorkItem;
+
+	///	<summary>
+	///		Process directories until none remain.
+	///	</summary>
+	void Work() {
+		std::vector<WorkItem> vecNewWork;
+		std::vector<std::string> vecNewFiles;
+
+		for (;;) {
+			WorkItem item;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				while (m_dequeWork.empty() && (m_nActive != 0)) {
+					m_condWork.wait(lock);
+				}
+				if (m_dequeWork.empty()) {
+					m_condWork.notify_all();
+					return;
+				}
+				item = m_dequeWork.front();
+				m_dequeWork.pop_front();
+				m_nActive++;
+			}
+
+			vecNewWork.clear();
+			vecNewFiles.clear();
+			ProcessDirectory(item, vecNewWork, vecNewFiles);
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_dequeWork.insert(
+					m_dequeWork.end(), vecNewWork.begin(), vecNewWork.end());
+				m_vecFiles.insert(
+					m_vecFiles.end(), vecNewFiles.begin(), vecNewFiles.end());
+				m_nActive--;
+			}
+			m_condWork.notify_all();
+		}
+	}
+
+	///	<summary>
+	///		Match the entries of a directory against a path component.
+	///	</summary>
+	void ProcessDirectory(
+		const WorkItem & item,
+		std::vector<WorkItem> & vecNewWork,
+		std::vector<std::string> & vecNewFiles
+	) {
+		const std::string & strDir = item.first;
+		size_t sComponent = item.second;
+
+		std::vector<DirectoryEntry> vecEntries;
+		bool fHaveEntries = false;
+
+		// "**" matches this directory and every directory below it that
+		// is not a symbolic link
+		if (m_vecComponents[sComponent] == "**") {
+			if (!ReadDirectory(strDir, vecEntries)) {
+				return;
+			}
+			fHaveEntries = true;
+
+			for (size_t i = 0; i < vecEntries.size(); i++) {
+				if (vecEntries[i].m_fIsDirectory && !vecEntries[i].m_fIsLink) {
+					vecNewWork.push_back(
+						WorkItem(
+							strDir + vecEntries[i].m_strName + "/",
+							sComponent));
+				}
+			}
+
+			// Trailing "**" matches every file in the tree
+			if (sComponent == m_vecComponents.size()-1) {
+				for (size_t i = 0; i < vecEntries.size(); i++) {
+					if (!vecEntries[i].m_fIsDirectory) {
+						vecNewFiles.push_back(strDir + vecEntries[i].m_strName);
+					}
+				}
+				return;
+			}
+
+			sComponent++;
+		}
+
+		const std::string & strComponent = m_vecComponents[sComponent];
+		const GlobPattern & glob = m_vecGlobs[sComponent];
+		bool fLastComponent = (sComponent == m_vecComponents.size()-1);
+
+		// Literal components are looked up directly
+		if (!GlobPattern::ContainsWildcard(strComponent)) {
+			std::string strPath = strDir + strComponent;
+			if (fLastComponent) {
+				struct stat statbuf;
+				if ((stat(strPath.c_str(), &statbuf) == 0) &&
+				    !S_ISDIR(statbuf.st_mode)
+				) {
+					vecNewFiles.push_back(strPath);
+				}
+			} else {
+				vecNewWork.push_back(WorkItem(strPath + "/", sComponent+1));
+			}
+			return;
+		}
+
+		// Wildcard components require a directory listing
+		if (!fHaveEntries) {
+			if (!ReadDirectory(strDir, vecEntries)) {
+				return;
+			}
+		}
+
+		for (size_t i = 0; i < vecEntries.size(); i++) {
+			const DirectoryEntry & entry = vecEntries[i];
+			if (entry.m_fIsDirectory == fLastComponent) {
+				continue;
+			}
+			if (!glob.Matches(entry.m_strName)) {
+				continue;
+			}
+
+			if (fLastComponent) {
+				vecNewFiles.push_back(strDir + entry.m_strName);
+			} else {
+				vecNewWork.push_back(
+					WorkItem(strDir + entry.m_strName + "/", sComponent+1));
+			}
+		}
+	}
+
+protected:
+	///	<summary>
+	///		Path components of the search pattern below the root.
+	///	</summary>
+	std::vector<std::string> m_vecComponents;
+
+	///	<summary>
+	///		Compiled pattern for each path component with wildcards.
+	///	</summary>
+	std::vector<GlobPattern> m_vecGlobs;
+
+	///	<summary>
+	///		Directories that remain to be processed.
+	///	</summary>
+	std::deque<WorkItem> m_dequeWork;
+
+	///	<summary>
+	///		Number of directories currently being processed.
+	///	</summary>
+	int m_nActive;
+
+	///	<summary>
+	///		Files found.
+	///	</summary>
+	std::vector<std::string> m_vecFiles;
+
+	///	<summary>
+	///		Mutex guarding the work queue and results.
+	///	</summary>
+	std::mutex m_mutex;
+
+	///	<summary>
+	///		Condition signalled when work is added or completed.
+	///	</summary>
+	std::condition_variable m_condWork;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string FindFilesFromSearchString(
+	const std::string & strSearchString,
+	int nThreads,
+	std::string & strBaseDir,
+	std::vector<std::string> & vecFiles
+) {
+	strBaseDir = "";
+	vecFiles.clear();
+
+	// Split into patterns
+	std::vector<std::string> vecPatterns;
+	{
+		size_t sBegin = 0;
+		for (;;) {
+			size_t sEnd = strSearchString.find(';', sBegin);
+			std::string strPattern =
+				strSearchString.substr(sBegin, sEnd - sBegin);
+			if (strPattern != "") {
+				vecPatterns.push_back(strPattern);
+			}
+			if (sEnd == std::string::npos) {
+				break;
+			}
+			sBegin = sEnd + 1;
+		}
+	}
+	if (vecPatterns.size() == 0) {
+		return std::string("Empty search string");
+	}
+
+	for (size_t p = 0; p < vecPatterns.size(); p++) {
+		const std::string & strPattern = vecPatterns[p];
+
+		// Split the pattern into path components
+		std::vector<std::string> vecComponents;
+		{
+			size_t sBegin = 0;
+			for (;;) {
+				size_t sEnd = strPattern.find('/', sBegin);
+				std::string strComponent =
+					strPattern.substr(sBegin, sEnd - sBegin);
+				if ((strComponent != "") && (strComponent != ".")) {
+					if ((strComponent != "**") ||
+					    (vecComponents.size() == 0) ||
+					    (vecComponents.back() != "**")
+					) {
+						vecComponents.push_back(strComponent);
+					}
+				}
+				if (sEnd == std::string::npos) {
+					break;
+				}
+				sBegin = sEnd + 1;
+			}
+		}
+		if (vecComponents.size() == 0) {
+			return std::string("Invalid search string \"")
+				+ strPattern + std::string("\"");
+		}
+
+		// The root is the longest prefix without wildcards
+		std::string strRootDir;
+		if (strPattern[0] == '/') {
+			strRootDir = "/";
+		}
+		size_t sRootComponents = 0;
+		for (; sRootComponents < vecComponents.size()-1; sRootComponents++) {
+			const std::string & strComponent = vecComponents[sRootComponents];
+			if ((strComponent == "**") ||
+			    GlobPattern::ContainsWildcard(strComponent)
+			) {
+				break;
+			}
+			strRootDir += strComponent + "/";
+		}
+		if (strRootDir == "") {
+			strRootDir = "./";
+		}
+		vecComponents.erase(
+			vecComponents.begin(),
+			vecComponents.begin() + sRootComponents);
+
+		// Check the root directory
+		DIR * pDir = opendir(strRootDir.c_str());
+		if (pDir == NULL) {
+			return std::string("Unable to open directory \"")
+				+ strRootDir + std::string("\"");
+		}
+		closedir(pDir);
+
+		if (p == 0) {
+			strBaseDir = strRootDir;
+		}
+
+		// Walk the tree
+		std::vector<std::string> vecPatternFiles;
+		DirectoryWalker walker(vecComponents);
+		walker.Run(strRootDir, nThreads, vecPatternFiles);
+
+		vecFiles.insert(
+			vecFiles.end(), vecPatternFiles.begin(), vecPatternFiles.end());
+	}
+
+	// Sort and remove files matched by more than one pattern
+	std::sort(vecFiles.begin(), vecFiles.end());
+	vecFiles.erase(
+		std::unique(vecFiles.begin(), vecFiles.end()),
+		vecFiles.end());
+
+	// Find the deepest directory that contains all files
+	if (vecFiles.size() != 0) {
+		const std::string & strFirst = vecFiles.front();
+		const std::string & strLast = vecFiles.back();
+
+		size_t sCommon = 0;
+		while ((sCommon < strFirst.length()) &&
+		       (sCommon < strLast.length()) &&
+		       (strFirst[sCommon] == strLast[sCommon])
+		) {
+			sCommon++;
+		}
+
+		size_t sSlash = strFirst.rfind('/', (sCommon == 0)?(0):(sCommon-1));
+		if ((sSlash == std::string::npos) || (sCommon == 0)) {
+			strBaseDir = "";
+		} else {
+			strBaseDir = strFirst.substr(0, sSlash+1);
+		}
+	}
+
+	return std::string("");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FileSearch.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _FILESEARCH_H_
+#define _FILESEARCH_H_
+
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Find all files that match the given search string.  The search
+///		string may contain several patterns separated by ';'.  Each
+///		pattern is a path whose components may contain wildcards (see
+///		GlobPattern), or be "**" to match any number of directories.
+///		Directories are read concurrently using nThreads threads.
+///		Symbolic links to directories are not followed by "**".
+///	</summary>
+///	<returns>
+///		An error string, or the empty string on success.  On success
+///		vecFiles contains the path of every match (sorted) and
+///		strBaseDir contains the deepest directory that contains all
+///		matches (or the root of the first pattern if nothing matched).
+///	</returns>
+std::string FindFilesFromSearchString(
+	const std::string & strSearchString,
+	int nThreads,
+	std::string & strBaseDir,
+	std::vector<std::string> & vecFiles
+);
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
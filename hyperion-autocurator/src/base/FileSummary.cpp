@@ -0,0 +1,733 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FileSummary.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "FileSummary.h"
+#include "ClassicNetCDFReader.h"
+#include "NetCDFUtilities.h"
+#include "Exception.h"
+#include "BinaryStream.h"
+
+#include <mutex>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// DataObjectSummary
+///////////////////////////////////////////////////////////////////////////////
+
+void DataObjectSummary::FromNcAttributes(
+	int iNcId,
+	int iVarId
+) {
+	int nAtts = GetNcAttCount(iNcId, iVarId);
+	if (nAtts < 0) {
+		_EXCEPTIONT("Unable to determine number of attributes");
+	}
+
+	std::string strAttName;
+	AttributeValue value;
+	for (int a = 0; a < nAtts; a++) {
+		if (!GetNcAttName(iNcId, iVarId, a, strAttName)) {
+			_EXCEPTION1("Unable to read name of attribute %i", a);
+		}
+		if (!GetNcAttValue(iNcId, iVarId, strAttName.c_str(), value)) {
+			_EXCEPTION1("Unable to read attribute \"%s\"", strAttName.c_str());
+		}
+		if (strAttName == "units") {
+			if (iVarId != NC_GLOBAL) {
+				m_strUnits = value.ToString();
+			}
+			continue;
+		}
+		m_vecAttributes.push_back(
+			AttributeList::value_type(
+				InternedString(strAttName), value));
+	}
+
+	ComputeAttributeFingerprint();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataObjectSummary::FromNcFile(
+	NcFile * ncfile
+) {
+	FromNcAttributes(ncfile->id(), NC_GLOBAL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataObjectSummary::FromNcVar(
+	NcFile * ncfile,
+	NcVar * var
+) {
+	m_strName = var->name();
+	m_nctype = var->type();
+
+	FromNcAttributes(ncfile->id(), var->id());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataObjectSummary::FromAttributeList(
+	const AttributeList & vecAttributes
+) {
+	bool fHasUnits = false;
+	for (size_t a = 0; a < vecAttributes.size(); a++) {
+		if (vecAttributes[a].first == "units") {
+			if (!fHasUnits) {
+				m_strUnits = vecAttributes[a].second.ToString();
+				fHasUnits = true;
+			}
+			continue;
+		}
+		m_vecAttributes.push_back(vecAttributes[a]);
+	}
+
+	ComputeAttributeFingerprint();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataObjectSummary::ComputeAttributeFingerprint() {
+
+	// Sum a mixed hash of each (name, value) pair so the order of the
+	// attributes does not matter.  The mixing function is the finalizer
+	// of SplitMix64.
+	m_uAttributeFingerprint = 0;
+	for (size_t a = 0; a < m_vecAttributes.size(); a++) {
+		uint64_t u =
+			static_cast<uint64_t>(m_vecAttributes[a].first.GetHash())
+			* 0x9e3779b97f4a7c15ULL
+			+ static_cast<uint64_t>(m_vecAttributes[a].second.GetHash());
+
+		u = (u ^ (u >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		u = (u ^ (u >> 27)) * 0x94d049bb133111ebULL;
+		u = u ^ (u >> 31);
+
+		m_uAttributeFingerprint += u;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataObjectSummary::Serialize(
+	std::ostream & os
+) const {
+	WriteBinary(os, m_strName);
+	WriteBinary<int32_t>(os, static_cast<int32_t>(m_nctype));
+	WriteBinary(os, m_strUnits);
+	WriteBinary<uint64_t>(os, m_vecAttributes.size());
+	for (size_t a = 0; a < m_vecAttributes.size(); a++) {
+		WriteBinary(os, m_vecAttributes[a].first);
+		m_vecAttributes[a].second.Serialize(os);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool DataObjectSummary::Deserialize(
+	std::istream & is
+) {
+	int32_t iNcType;
+	uint64_t sAttributes;
+
+	if (!ReadBinary(is, m_strName)) return false;
+	if (!ReadBinary<int32_t>(is, iNcType)) return false;
+	if (!ReadBinary(is, m_strUnits)) return false;
+	if (!ReadBinary<uint64_t>(is, sAttributes)) return false;
+	if (sAttributes > MaximumSerializedLength) return false;
+
+	m_nctype = static_cast<NcType>(iNcType);
+
+	m_vecAttributes.resize(sAttributes);
+	for (size_t a = 0; a < m_vecAttributes.size(); a++) {
+		if (!ReadBinary(is, m_vecAttributes[a].first)) return false;
+		if (!m_vecAttributes[a].second.Deserialize(is)) return false;
+	}
+
+	ComputeAttributeFingerprint();
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DimensionSummary
+///////////////////////////////////////////////////////////////////////////////
+
+void DimensionSummary::Serialize(
+	std::ostream & os
+) const {
+	DataObjectSummary::Serialize(os);
+	WriteBinary<int64_t>(os, m_lSize);
+	WriteBinary<uint8_t>(os, m_fHasVariable);
+	WriteBinary(os, m_strError);
+	WriteBinary(os, m_dValuesFloat);
+	WriteBinary(os, m_dValuesDouble);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool DimensionSummary::Deserialize(
+	std::istream & is
+) {
+	int64_t lSize;
+	uint8_t iHasVariable;
+
+	if (!DataObjectSummary::Deserialize(is)) return false;
+	if (!ReadBinary<int64_t>(is, lSize)) return false;
+	if (!ReadBinary<uint8_t>(is, iHasVariable)) return false;
+	if (!ReadBinary(is, m_strError)) return false;
+	if (!ReadBinary(is, m_dValuesFloat)) return false;
+	if (!ReadBinary(is, m_dValuesDouble)) return false;
+
+	m_lSize = static_cast<long>(lSize);
+	m_fHasVariable = (iHasVariable != 0);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// VariableSummary
+///////////////////////////////////////////////////////////////////////////////
+
+void VariableSummary::Serialize(
+	std::ostream & os
+) const {
+	DataObjectSummary::Serialize(os);
+	WriteBinary(os, m_vecDimNames);
+	WriteBinary(os, m_vecDimSizes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool VariableSummary::Deserialize(
+	std::istream & is
+) {
+	if (!DataObjectSummary::Deserialize(is)) return false;
+	if (!ReadBinary(is, m_vecDimNames)) return false;
+	if (!ReadBinary(is, m_vecDimSizes)) return false;
+	if (m_vecDimNames.size() != m_vecDimSizes.size()) return false;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// FileSummary
+///////////////////////////////////////////////////////////////////////////////
+
+void FileSummary::FromFile(
+	const std::string & strFullFilename,
+	const std::string & strRecordDimName
+) {
+	m_strFilename = strFullFilename;
+
+	// Classic format files are read directly, without taking the lock
+	{
+		ClassicNetCDFReader reader;
+		if (reader.Open(strFullFilename)) {
+			try {
+				if (FromClassicNetCDFReader(reader, strRecordDimName)) {
+					return;
+				}
+			} catch(Exception & e) {
+				m_strError = e.ToString();
+				return;
+			}
+		}
+	}
+
+	// Fall back to libnetcdf
+	(*this) = FileSummary();
+	m_strFilename = strFullFilename;
+
+	// Touch the file and schedule its header for readahead outside of the
+	// NetCDF lock, so that concurrent callers overlap the filesystem
+	// lookup and first read, which dominate on parallel filesystems.
+	int fd = open(strFullFilename.c_str(), O_RDONLY);
+	if (fd != (-1)) {
+#if defined(POSIX_FADV_WILLNEED)
+		posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+#endif
+		close(fd);
+	}
+
+	std::lock_guard<std::mutex> lock(GetNetCDFMutex());
+
+	// Only metadata and coordinate variables are read, so open without
+	// chunk caches; the default mode is restored once the file is closed
+	size_t sBufferSize = SetNetCDFOpenMode(NetCDFOpenMetadataScan);
+
+	try {
+		NcFile ncFile(strFullFilename.c_str(), NcFile::ReadOnly, &sBufferSize);
+		if (!ncFile.is_valid()) {
+			m_strError =
+				std::string("Unable to open data file \"")
+				+ strFullFilename + std::string("\" for reading");
+		} else {
+			FromNcFile(ncFile, strRecordDimName);
+		}
+
+	} catch(Exception & e) {
+		m_strError = e.ToString();
+	}
+
+	SetNetCDFOpenMode(NetCDFOpenDefault);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FileSummary::FromNcFile(
+	NcFile & ncFile,
+	const std::string & strRecordDimName
+) {
+	// Load in global attributes
+	m_datainfo.FromNcFile(&ncFile);
+
+	// Find the time variable, if it exists
+	NcVar * varTime = ncFile.get_var(strRecordDimName.c_str());
+	if (varTime != NULL) {
+		m_fHasTimeVariable = true;
+		m_nctypeTime = varTime->type();
+
+		if (varTime->num_dims() != 1) {
+			m_strTimeError = std::string("\"")
+				+ strRecordDimName
+				+ std::string("\" variable must contain exactly one dimension in \"")
+				+ m_strFilename + std::string("\"");
+
+		} else if ((m_nctypeTime != ncInt) && (m_nctypeTime != ncDouble)) {
+			m_strTimeError = std::string("\"")
+				+ strRecordDimName
+				+ std::string("\" variable must be ncInt or ncDouble in \"")
+				+ m_strFilename + std::string("\"");
+
+		} else {
+			NcDim * dimTime = varTime->get_dim(0);
+			if (dimTime == NULL) {
+				_EXCEPTION1("Malformed NetCDF file \"%s\"",
+					m_strFilename.c_str());
+			}
+
+			// Get calendar
+			std::string strTimeCalendar;
+			if (!GetNcAttAsString(
+				ncFile.id(), varTime->id(), "calendar", strTimeCalendar)
+			) {
+				m_eTimeCalendar = Time::CalendarStandard;
+			} else {
+				m_eTimeCalendar = Time::CalendarTypeFromString(strTimeCalendar);
+				if (m_eTimeCalendar == Time::CalendarUnknown) {
+					m_strTimeError = std::string("Unknown calendar \"")
+						+ strTimeCalendar
+						+ std::string("\" in \"")
+						+ m_strFilename + std::string("\"");
+				}
+			}
+
+			// Get units attribute
+			if (GetNcAttAsString(
+				ncFile.id(), varTime->id(), "units", m_strTimeUnits)
+			) {
+				m_fHasTimeUnits = true;
+			}
+
+			// Get time values
+			long lTimes = dimTime->size();
+			m_dTimeValues.resize(lTimes);
+			if ((m_strTimeError == "") && (lTimes != 0)) {
+				varTime->set_cur((long)0);
+				if (m_nctypeTime == ncInt) {
+					std::vector<int> nTimes(lTimes);
+					varTime->get(&(nTimes[0]), lTimes);
+					for (long t = 0; t < lTimes; t++) {
+						m_dTimeValues[t] = static_cast<double>(nTimes[t]);
+					}
+				} else {
+					varTime->get(&(m_dTimeValues[0]), lTimes);
+				}
+			}
+
+			// Decode time values
+			if ((m_strTimeError == "") && HasDecodedTimes()) {
+				DecodeTimes();
+			}
+		}
+	}
+
+	// Load all dimensions
+	const int nDims = ncFile.num_dims();
+	m_vecDimensions.resize(nDims);
+	for (int d = 0; d < nDims; d++) {
+		NcDim * dim = ncFile.get_dim(d);
+		DimensionSummary & dimsum = m_vecDimensions[d];
+
+		dimsum.m_strName = dim->name();
+		dimsum.m_lSize = dim->size();
+
+		// Check for dimension variable
+		NcVar * varDim = ncFile.get_var(dimsum.m_strName.c_str());
+		if (varDim == NULL) {
+			continue;
+		}
+
+		dimsum.m_fHasVariable = true;
+
+		if (varDim->num_dims() != 1) {
+			dimsum.m_strError = std::string("ERROR: Dimension variable \"")
+				+ varDim->name()
+				+ std::string("\" must have exactly 1 dimension");
+			continue;
+		}
+		if (std::string(varDim->get_dim(0)->name()) != dimsum.m_strName) {
+			dimsum.m_strError = std::string("ERROR: Dimension variable \"")
+				+ varDim->name()
+				+ std::string("\" does not have dimension \"")
+				+ varDim->name()
+				+ std::string("\"");
+			continue;
+		}
+
+		dimsum.FromNcVar(&ncFile, varDim);
+
+		// Get the values from the dimension
+		if (dimsum.m_lSize != 0) {
+			if (dimsum.m_nctype == ncDouble) {
+				dimsum.m_dValuesDouble.resize(dimsum.m_lSize);
+				varDim->set_cur((long)0);
+				varDim->get(&(dimsum.m_dValuesDouble[0]), dimsum.m_lSize);
+			} else if (dimsum.m_nctype == ncFloat) {
+				dimsum.m_dValuesFloat.resize(dimsum.m_lSize);
+				varDim->set_cur((long)0);
+				varDim->get(&(dimsum.m_dValuesFloat[0]), dimsum.m_lSize);
+			}
+		}
+	}
+
+	// Load all variables
+	const int nVariables = ncFile.num_vars();
+	m_vecVariables.resize(nVariables);
+	for (int v = 0; v < nVariables; v++) {
+		NcVar * var = ncFile.get_var(v);
+		if (var == NULL) {
+			_EXCEPTION1("Malformed NetCDF file \"%s\"",
+				m_strFilename.c_str());
+		}
+
+		VariableSummary & varsum = m_vecVariables[v];
+
+		varsum.FromNcVar(&ncFile, var);
+
+		const int nVarDims = var->num_dims();
+		varsum.m_vecDimNames.resize(nVarDims);
+		varsum.m_vecDimSizes.resize(nVarDims);
+		for (int d = 0; d < nVarDims; d++) {
+			varsum.m_vecDimNames[d] = InternedString(var->get_dim(d)->name());
+			varsum.m_vecDimSizes[d] = var->get_dim(d)->size();
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool FileSummary::FromClassicNetCDFReader(
+	const ClassicNetCDFReader & reader,
+	const std::string & strRecordDimName
+) {
+	typedef ClassicNetCDFReader::Dimension Dimension;
+	typedef ClassicNetCDFReader::Variable Variable;
+
+	const std::vector<Dimension> & vecDims = reader.GetDimensions();
+	const std::vector<Variable> & vecVars = reader.GetVariables();
+
+	// Load in global attributes
+	const AttributeList & vecGlobalAttributes = reader.GetAttributes();
+	for (size_t a = 0; a < vecGlobalAttributes.size(); a++) {
+		if (vecGlobalAttributes[a].first != "units") {
+			m_datainfo.m_vecAttributes.push_back(vecGlobalAttributes[a]);
+		}
+	}
+	m_datainfo.ComputeAttributeFingerprint();
+
+	// Find the time variable, if it exists
+	int iVarTime = reader.FindVariable(strRecordDimName);
+	if (iVarTime != (-1)) {
+		const Variable & varTime = vecVars[iVarTime];
+
+		m_fHasTimeVariable = true;
+		m_nctypeTime = varTime.m_nctype;
+
+		if (varTime.m_vecDimIx.size() != 1) {
+			m_strTimeError = std::string("\"")
+				+ strRecordDimName
+				+ std::string("\" variable must contain exactly one dimension in \"")
+				+ m_strFilename + std::string("\"");
+
+		} else if ((m_nctypeTime != ncInt) && (m_nctypeTime != ncDouble)) {
+			m_strTimeError = std::string("\"")
+				+ strRecordDimName
+				+ std::string("\" variable must be ncInt or ncDouble in \"")
+				+ m_strFilename + std::string("\"");
+
+		} else {
+			// Get calendar and units attributes
+			bool fHasCalendar = false;
+			std::string strTimeCalendar;
+			for (size_t a = 0; a < varTime.m_vecAttributes.size(); a++) {
+				const AttributeList::value_type & att = varTime.m_vecAttributes[a];
+				if ((att.first == "calendar") && !fHasCalendar) {
+					fHasCalendar = true;
+					strTimeCalendar = att.second.ToString();
+				}
+				if ((att.first == "units") && !m_fHasTimeUnits) {
+					m_fHasTimeUnits = true;
+					m_strTimeUnits = att.second.ToString();
+				}
+			}
+
+			if (!fHasCalendar) {
+				m_eTimeCalendar = Time::CalendarStandard;
+			} else {
+				m_eTimeCalendar = Time::CalendarTypeFromString(strTimeCalendar);
+				if (m_eTimeCalendar == Time::CalendarUnknown) {
+					m_strTimeError = std::string("Unknown calendar \"")
+						+ strTimeCalendar
+						+ std::string("\" in \"")
+						+ m_strFilename + std::string("\"");
+				}
+			}
+
+			// Get time values
+			long lTimes = vecDims[varTime.m_vecDimIx[0]].m_lSize;
+			m_dTimeValues.resize(lTimes);
+			if ((m_strTimeError == "") && (lTimes != 0)) {
+				if (!reader.ReadValues(iVarTime, m_dTimeValues)) {
+					return false;
+				}
+			}
+
+			// Decode time values
+			if ((m_strTimeError == "") && HasDecodedTimes()) {
+				DecodeTimes();
+			}
+		}
+	}
+
+	// Load all dimensions
+	m_vecDimensions.resize(vecDims.size());
+	for (size_t d = 0; d < vecDims.size(); d++) {
+		DimensionSummary & dimsum = m_vecDimensions[d];
+
+		dimsum.m_strName = vecDims[d].m_strName;
+		dimsum.m_lSize = vecDims[d].m_lSize;
+
+		// Check for dimension variable
+		int iVarDim = reader.FindVariable(dimsum.m_strName);
+		if (iVarDim == (-1)) {
+			continue;
+		}
+
+		const Variable & varDim = vecVars[iVarDim];
+
+		dimsum.m_fHasVariable = true;
+
+		if (varDim.m_vecDimIx.size() != 1) {
+			dimsum.m_strError = std::string("ERROR: Dimension variable \"")
+				+ varDim.m_strName
+				+ std::string("\" must have exactly 1 dimension");
+			continue;
+		}
+		if (vecDims[varDim.m_vecDimIx[0]].m_strName != dimsum.m_strName) {
+			dimsum.m_strError = std::string("ERROR: Dimension variable \"")
+				+ varDim.m_strName
+				+ std::string("\" does not have dimension \"")
+				+ varDim.m_strName
+				+ std::string("\"");
+			continue;
+		}
+
+		dimsum.m_nctype = varDim.m_nctype;
+		dimsum.FromAttributeList(varDim.m_vecAttributes);
+
+		// Get the values from the dimension
+		if (dimsum.m_lSize != 0) {
+			if (dimsum.m_nctype == ncDouble) {
+				if (!reader.ReadValues(iVarDim, dimsum.m_dValuesDouble)) {
+					return false;
+				}
+			} else if (dimsum.m_nctype == ncFloat) {
+				if (!reader.ReadValues(iVarDim, dimsum.m_dValuesFloat)) {
+					return false;
+				}
+			}
+		}
+	}
+
+	// Load all variables
+	m_vecVariables.resize(vecVars.size());
+	for (size_t v = 0; v < vecVars.size(); v++) {
+		const Variable & var = vecVars[v];
+		VariableSummary & varsum = m_vecVariables[v];
+
+		varsum.m_strName = var.m_strName;
+		varsum.m_nctype = var.m_nctype;
+		varsum.FromAttributeList(var.m_vecAttributes);
+
+		const size_t nVarDims = var.m_vecDimIx.size();
+		varsum.m_vecDimNames.resize(nVarDims);
+		varsum.m_vecDimSizes.resize(nVarDims);
+		for (size_t d = 0; d < nVarDims; d++) {
+			varsum.m_vecDimNames[d] = InternedString(vecDims[var.m_vecDimIx[d]].m_strName);
+			varsum.m_vecDimSizes[d] = vecDims[var.m_vecDimIx[d]].m_lSize;
+		}
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FileSummary::DecodeTimeValues(
+	const std::string & strTimeUnits,
+	Time::CalendarType eTimeCalendar,
+	NcType nctypeTime,
+	const std::vector<double> & dTimeValues,
+	std::vector<Time> & vecTimes
+) {
+	if (nctypeTime == ncInt) {
+		std::vector<int> nTimeValues(dTimeValues.size());
+		for (size_t t = 0; t < dTimeValues.size(); t++) {
+			nTimeValues[t] = static_cast<int>(dTimeValues[t]);
+		}
+		Time::FromCFCompliantUnitsOffsets(
+			strTimeUnits, eTimeCalendar, nTimeValues, vecTimes);
+
+	} else if (nctypeTime == ncDouble) {
+		Time::FromCFCompliantUnitsOffsets(
+			strTimeUnits, eTimeCalendar, dTimeValues, vecTimes);
+
+	} else {
+		vecTimes.clear();
+		vecTimes.resize(dTimeValues.size(), Time(eTimeCalendar));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FileSummary::DecodeTimes() {
+	DecodeTimeValues(
+		m_strTimeUnits,
+		m_eTimeCalendar,
+		m_nctypeTime,
+		m_dTimeValues,
+		m_vecTimes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FileSummary::Serialize(
+	std::ostream & os
+) const {
+	WriteBinary(os, m_strFilename);
+	WriteBinary(os, m_strError);
+
+	m_datainfo.Serialize(os);
+
+	WriteBinary<uint8_t>(os, m_fHasTimeVariable);
+	WriteBinary(os, m_strTimeError);
+	WriteBinary<int32_t>(os, static_cast<int32_t>(m_nctypeTime));
+	WriteBinary<int32_t>(os, static_cast<int32_t>(m_eTimeCalendar));
+	WriteBinary<uint8_t>(os, m_fHasTimeUnits);
+	WriteBinary(os, m_strTimeUnits);
+	WriteBinary(os, m_dTimeValues);
+
+	WriteBinary<uint64_t>(os, m_vecDimensions.size());
+	for (size_t d = 0; d < m_vecDimensions.size(); d++) {
+		m_vecDimensions[d].Serialize(os);
+	}
+
+	WriteBinary<uint64_t>(os, m_vecVariables.size());
+	for (size_t v = 0; v < m_vecVariables.size(); v++) {
+		m_vecVariables[v].Serialize(os);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool FileSummary::Deserialize(
+	std::istream & is
+) {
+	uint8_t iHasTimeVariable;
+	int32_t iNcTypeTime;
+	int32_t iTimeCalendar;
+	uint8_t iHasTimeUnits;
+	uint64_t sDimensions;
+	uint64_t sVariables;
+
+	(*this) = FileSummary();
+
+	if (!ReadBinary(is, m_strFilename)) return false;
+	if (!ReadBinary(is, m_strError)) return false;
+
+	if (!m_datainfo.Deserialize(is)) return false;
+
+	if (!ReadBinary<uint8_t>(is, iHasTimeVariable)) return false;
+	if (!ReadBinary(is, m_strTimeError)) return false;
+	if (!ReadBinary<int32_t>(is, iNcTypeTime)) return false;
+	if (!ReadBinary<int32_t>(is, iTimeCalendar)) return false;
+	if (!ReadBinary<uint8_t>(is, iHasTimeUnits)) return false;
+	if (!ReadBinary(is, m_strTimeUnits)) return false;
+	if (!ReadBinary(is, m_dTimeValues)) return false;
+
+	m_fHasTimeVariable = (iHasTimeVariable != 0);
+	m_nctypeTime = static_cast<NcType>(iNcTypeTime);
+	m_eTimeCalendar = static_cast<Time::CalendarType>(iTimeCalendar);
+	m_fHasTimeUnits = (iHasTimeUnits != 0);
+
+	if (m_eTimeCalendar == Time::CalendarUnknown) {
+		if (m_strTimeError == "") {
+			return false;
+		}
+		m_eTimeCalendar = Time::CalendarStandard;
+	}
+
+	if (!ReadBinary<uint64_t>(is, sDimensions)) return false;
+	if (sDimensions > MaximumSerializedLength) return false;
+	m_vecDimensions.resize(sDimensions);
+	for (size_t d = 0; d < m_vecDimensions.size(); d++) {
+		if (!m_vecDimensions[d].Deserialize(is)) return false;
+	}
+
+	if (!ReadBinary<uint64_t>(is, sVariables)) return false;
+	if (sVariables > MaximumSerializedLength) return false;
+	m_vecVariables.resize(sVariables);
+	for (size_t v = 0; v < m_vecVariables.size(); v++) {
+		if (!m_vecVariables[v].Deserialize(is)) return false;
+	}
+
+	// Decoded times are not stored; rebuild them from the raw values
+	if ((m_strError == "") && (m_strTimeError == "") && HasDecodedTimes()) {
+		try {
+			DecodeTimes();
+		} catch(Exception & e) {
+			m_strError = e.ToString();
+		}
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
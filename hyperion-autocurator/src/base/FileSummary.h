@@ -0,0 +1,391 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FileSummary.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _FILESUMMARY_H_
+#define _FILESUMMARY_H_
+
+#include "TimeObj.h"
+#include "StringPool.h"
+#include "AttributeValue.h"
+#include "netcdfcpp.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A list of attribute names and typed values, in the order they
+///		appear in the file.  Names are interned, since the same attributes
+///		recur across the files of an archive.
+///	</summary>
+typedef std::vector< std::pair<InternedString, AttributeValue> > AttributeList;
+
+class ClassicNetCDFReader;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Metadata for a single data object (the file itself, a dimension
+///		variable or a variable) as read from one file.
+///	</summary>
+class DataObjectSummary {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	DataObjectSummary() :
+		m_nctype(ncNoType),
+		m_uAttributeFingerprint(0)
+	{ }
+
+public:
+	///	<summary>
+	///		Read global attributes from a NcFile.
+	///	</summary>
+	void FromNcFile(
+		NcFile * ncfile
+	);
+
+	///	<summary>
+	///		Read name, type, units and attributes from a NcVar in ncfile.
+	///	</summary>
+	void FromNcVar(
+		NcFile * ncfile,
+		NcVar * var
+	);
+
+	///	<summary>
+	///		Read units and attributes from an AttributeList.
+	///	</summary>
+	void FromAttributeList(
+		const AttributeList & vecAttributes
+	);
+
+	///	<summary>
+	///		Read units and attributes of the variable iVarId, or global
+	///		attributes if iVarId is NC_GLOBAL, through the netCDF C interface.
+	///	</summary>
+	void FromNcAttributes(
+		int iNcId,
+		int iVarId
+	);
+
+	///	<summary>
+	///		Compute m_uAttributeFingerprint from m_vecAttributes.
+	///	</summary>
+	void ComputeAttributeFingerprint();
+
+	///	<summary>
+	///		Write to a binary stream.
+	///	</summary>
+	void Serialize(
+		std::ostream & os
+	) const;
+
+	///	<summary>
+	///		Read from a binary stream.
+	///	</summary>
+	bool Deserialize(
+		std::istream & is
+	);
+
+public:
+	///	<summary>
+	///		Data object name.
+	///	</summary>
+	std::string m_strName;
+
+	///	<summary>
+	///		NcType of the data object.
+	///	</summary>
+	NcType m_nctype;
+
+	///	<summary>
+	///		Units of the data object.
+	///	</summary>
+	std::string m_strUnits;
+
+	///	<summary>
+	///		Attributes of the data object, excluding "units".
+	///	</summary>
+	AttributeList m_vecAttributes;
+
+	///	<summary>
+	///		A fingerprint of m_vecAttributes which does not depend on the
+	///		order of the attributes.  Equal attribute sets have equal
+	///		fingerprints within a process; the fingerprint is not
+	///		serialized and is recomputed by Deserialize().
+	///	</summary>
+	uint64_t m_uAttributeFingerprint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Metadata for a single dimension as read from one file.
+///	</summary>
+class DimensionSummary : public DataObjectSummary {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	DimensionSummary() :
+		m_lSize(0),
+		m_fHasVariable(false)
+	{ }
+
+public:
+	///	<summary>
+	///		Write to a binary stream.
+	///	</summary>
+	void Serialize(
+		std::ostream & os
+	) const;
+
+	///	<summary>
+	///		Read from a binary stream.
+	///	</summary>
+	bool Deserialize(
+		std::istream & is
+	);
+
+public:
+	///	<summary>
+	///		Dimension size.
+	///	</summary>
+	long m_lSize;
+
+	///	<summary>
+	///		Flag indicating a dimension variable is present.
+	///	</summary>
+	bool m_fHasVariable;
+
+	///	<summary>
+	///		Error encountered while reading the dimension variable.
+	///	</summary>
+	std::string m_strError;
+
+	///	<summary>
+	///		Dimension values as floats.
+	///	</summary>
+	std::vector<float> m_dValuesFloat;
+
+	///	<summary>
+	///		Dimension values as doubles.
+	///	</summary>
+	std::vector<double> m_dValuesDouble;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Metadata for a single variable as read from one file.
+///	</summary>
+class VariableSummary : public DataObjectSummary {
+
+public:
+	///	<summary>
+	///		Write to a binary stream.
+	///	</summary>
+	void Serialize(
+		std::ostream & os
+	) const;
+
+	///	<summary>
+	///		Read from a binary stream.
+	///	</summary>
+	bool Deserialize(
+		std::istream & is
+	);
+
+public:
+	///	<summary>
+	///		Dimension names.
+	///	</summary>
+	std::vector<InternedString> m_vecDimNames;
+
+	///	<summary>
+	///		Size of each dimension.
+	///	</summary>
+	std::vector<long> m_vecDimSizes;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		All of the metadata needed to index a single file.  A FileSummary
+///		is populated without reference to any other file, so summaries can
+///		be built concurrently, cached or sent between processes and merged
+///		into a FileListObject afterwards.
+///	</summary>
+class FileSummary {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FileSummary() :
+		m_fHasTimeVariable(false),
+		m_nctypeTime(ncNoType),
+		m_eTimeCalendar(Time::CalendarStandard),
+		m_fHasTimeUnits(false)
+	{ }
+
+public:
+	///	<summary>
+	///		Populate from the given file.  Classic format files are read
+	///		with ClassicNetCDFReader; other files go through libnetcdf.
+	///	</summary>
+	void FromFile(
+		const std::string & strFullFilename,
+		const std::string & strRecordDimName
+	);
+
+	///	<summary>
+	///		Write to a binary stream.
+	///	</summary>
+	void Serialize(
+		std::ostream & os
+	) const;
+
+	///	<summary>
+	///		Read from a binary stream.  Returns false if the stream does
+	///		not contain a valid FileSummary.
+	///	</summary>
+	bool Deserialize(
+		std::istream & is
+	);
+
+	///	<summary>
+	///		Decode values of a record variable of type ncInt or ncDouble
+	///		with the given units and calendar.
+	///	</summary>
+	static void DecodeTimeValues(
+		const std::string & strTimeUnits,
+		Time::CalendarType eTimeCalendar,
+		NcType nctypeTime,
+		const std::vector<double> & dTimeValues,
+		std::vector<Time> & vecTimes
+	);
+
+	///	<summary>
+	///		Check if m_vecTimes holds the decoded record variable.  If
+	///		false the file has no "units" of its own and the values must
+	///		be decoded with the units of a previous file.
+	///	</summary>
+	bool HasDecodedTimes() const {
+		return (m_fHasTimeUnits && (m_strTimeUnits != ""));
+	}
+
+protected:
+	///	<summary>
+	///		Populate from an open NcFile.
+	///	</summary>
+	void FromNcFile(
+		NcFile & ncFile,
+		const std::string & strRecordDimName
+	);
+
+	///	<summary>
+	///		Populate from a ClassicNetCDFReader.  Returns false if variable
+	///		data could not be read, in which case libnetcdf should be used.
+	///	</summary>
+	bool FromClassicNetCDFReader(
+		const ClassicNetCDFReader & reader,
+		const std::string & strRecordDimName
+	);
+
+	///	<summary>
+	///		Decode m_dTimeValues into m_vecTimes.
+	///	</summary>
+	void DecodeTimes();
+
+public:
+	///	<summary>
+	///		Full path to the file.
+	///	</summary>
+	std::string m_strFilename;
+
+	///	<summary>
+	///		Error encountered while opening the file.
+	///	</summary>
+	std::string m_strError;
+
+	///	<summary>
+	///		Global attributes.
+	///	</summary>
+	DataObjectSummary m_datainfo;
+
+	///	<summary>
+	///		Flag indicating the record variable is present.
+	///	</summary>
+	bool m_fHasTimeVariable;
+
+	///	<summary>
+	///		Error encountered while reading the record variable.
+	///	</summary>
+	std::string m_strTimeError;
+
+	///	<summary>
+	///		NcType of the record variable.
+	///	</summary>
+	NcType m_nctypeTime;
+
+	///	<summary>
+	///		Calendar of the record variable.
+	///	</summary>
+	Time::CalendarType m_eTimeCalendar;
+
+	///	<summary>
+	///		Flag indicating the record variable has a "units" attribute.
+	///	</summary>
+	bool m_fHasTimeUnits;
+
+	///	<summary>
+	///		Units of the record variable.
+	///	</summary>
+	std::string m_strTimeUnits;
+
+	///	<summary>
+	///		Values of the record variable.
+	///	</summary>
+	std::vector<double> m_dTimeValues;
+
+	///	<summary>
+	///		Decoded values of the record variable (see HasDecodedTimes).
+	///	</summary>
+	std::vector<Time> m_vecTimes;
+
+	///	<summary>
+	///		Dimensions, in file order.
+	///	</summary>
+	std::vector<DimensionSummary> m_vecDimensions;
+
+	///	<summary>
+	///		Variables, in file order.
+	///	</summary>
+	std::vector<VariableSummary> m_vecVariables;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
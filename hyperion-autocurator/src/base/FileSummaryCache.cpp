@@ -0,0 +1,260 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FileSummaryCache.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "FileSummaryCache.h"
+#include "BinaryStream.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Identifier at the start of every cache file.
+///	</summary>
+static const char CacheFileMagic[8] = { 'H','Y','P','C','A','C','H','E' };
+
+///	<summary>
+///		Version of the cache file format.  Increment whenever the layout
+///		of FileSummary::Serialize() changes.
+///	</summary>
+static const uint32_t CacheFileVersion = 2;
+
+///////////////////////////////////////////////////////////////////////////////
+// FileStat
+///////////////////////////////////////////////////////////////////////////////
+
+bool FileStat::FromFile(
+	const std::string & strFullFilename
+) {
+	struct stat statbuf;
+	if (stat(strFullFilename.c_str(), &statbuf) != 0) {
+		return false;
+	}
+
+	m_sSize = static_cast<uint64_t>(statbuf.st_size);
+	m_iModTimeSec = static_cast<int64_t>(statbuf.st_mtime);
+#if defined(__APPLE__)
+	m_iModTimeNSec = static_cast<int64_t>(statbuf.st_mtimespec.tv_nsec);
+#else
+	m_iModTimeNSec = static_cast<int64_t>(statbuf.st_mtim.tv_nsec);
+#endif
+	m_sInode = static_cast<uint64_t>(statbuf.st_ino);
+	m_sDevice = static_cast<uint64_t>(statbuf.st_dev);
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// FileSummaryCache
+///////////////////////////////////////////////////////////////////////////////
+
+std::string FileSummaryCache::Read(
+	const std::string & strCacheFile,
+	const std::string & strRecordDimName
+) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_strRecordDimName = strRecordDimName;
+	m_mapEntries.clear();
+
+	std::ifstream ifCache(strCacheFile.c_str(), std::ios::binary);
+	if (!ifCache.is_open()) {
+		return std::string("");
+	}
+
+	// Read the header
+	char szMagic[sizeof(CacheFileMagic)];
+	uint32_t iVersion;
+	std::string strCacheRecordDimName;
+	uint64_t sEntries;
+
+	ifCache.read(szMagic, sizeof(CacheFileMagic));
+	if (ifCache.fail() ||
+	    (memcmp(szMagic, CacheFileMagic, sizeof(CacheFileMagic)) != 0)
+	) {
+		return std::string("File \"") + strCacheFile
+			+ std::string("\" is not a valid cache file");
+	}
+	if (!ReadBinary<uint32_t>(ifCache, iVersion) ||
+	    !ReadBinary(ifCache, strCacheRecordDimName) ||
+	    !ReadBinary<uint64_t>(ifCache, sEntries)
+	) {
+		return std::string("Cache file \"") + strCacheFile
+			+ std::string("\" is truncated");
+	}
+
+	// Outdated cache files are silently replaced
+	if ((iVersion != CacheFileVersion) ||
+	    (strCacheRecordDimName != m_strRecordDimName)
+	) {
+		return std::string("");
+	}
+
+	// The entry count is not used to allocate memory, so a corrupt
+	// count is caught as a truncated file
+	if (sEntries > MaximumSerializedLength) {
+		return std::string("File \"") + strCacheFile
+			+ std::string("\" is not a valid cache file");
+	}
+
+	// Read the entries
+	for (uint64_t i = 0; i < sEntries; i++) {
+		std::string strKey;
+		Entry entry;
+
+		if (!ReadBinary(ifCache, strKey) ||
+		    !ReadBinary<uint64_t>(ifCache, entry.m_filestat.m_sSize) ||
+		    !ReadBinary<int64_t>(ifCache, entry.m_filestat.m_iModTimeSec) ||
+		    !ReadBinary<int64_t>(ifCache, entry.m_filestat.m_iModTimeNSec) ||
+		    !ReadBinary<uint64_t>(ifCache, entry.m_filestat.m_sInode) ||
+		    !ReadBinary<uint64_t>(ifCache, entry.m_filestat.m_sDevice) ||
+		    !ReadBinary(ifCache, entry.m_strSummary)
+		) {
+			m_mapEntries.clear();
+			return std::string("Cache file \"") + strCacheFile
+				+ std::string("\" is truncated");
+		}
+
+		m_mapEntries[strKey] = std::move(entry);
+	}
+
+	return std::string("");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string FileSummaryCache::Write(
+	const std::string & strCacheFile
+) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// Write to a temporary file and rename it over the cache file, so an
+	// interrupted run never leaves a partially written cache behind
+	std::string strTempFile = strCacheFile + std::string(".tmp");
+
+	std::ofstream ofCache(strTempFile.c_str(), std::ios::binary);
+	if (!ofCache.is_open()) {
+		return std::string("Unable to open cache file \"")
+			+ strTempFile + std::string("\" for writing");
+	}
+
+	ofCache.write(CacheFileMagic, sizeof(CacheFileMagic));
+	WriteBinary<uint32_t>(ofCache, CacheFileVersion);
+	WriteBinary(ofCache, m_strRecordDimName);
+
+	// Only files seen in this run are kept, so entries for files that
+	// were deleted or renamed are dropped
+	uint64_t sEntries = 0;
+	EntryMap::const_iterator iter = m_mapEntries.begin();
+	for (; iter != m_mapEntries.end(); iter++) {
+		if (iter->second.m_fSeen) {
+			sEntries++;
+		}
+	}
+	WriteBinary<uint64_t>(ofCache, sEntries);
+
+	iter = m_mapEntries.begin();
+	for (; iter != m_mapEntries.end(); iter++) {
+		if (!iter->second.m_fSeen) {
+			continue;
+		}
+
+		const FileStat & filestat = iter->second.m_filestat;
+
+		WriteBinary(ofCache, iter->first);
+		WriteBinary<uint64_t>(ofCache, filestat.m_sSize);
+		WriteBinary<int64_t>(ofCache, filestat.m_iModTimeSec);
+		WriteBinary<int64_t>(ofCache, filestat.m_iModTimeNSec);
+		WriteBinary<uint64_t>(ofCache, filestat.m_sInode);
+		WriteBinary<uint64_t>(ofCache, filestat.m_sDevice);
+		WriteBinary(ofCache, iter->second.m_strSummary);
+	}
+
+	ofCache.close();
+	if (ofCache.fail()) {
+		return std::string("Error writing cache file \"")
+			+ strTempFile + std::string("\"");
+	}
+
+	if (rename(strTempFile.c_str(), strCacheFile.c_str()) != 0) {
+		return std::string("Unable to replace cache file \"")
+			+ strCacheFile + std::string("\"");
+	}
+
+	return std::string("");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool FileSummaryCache::Lookup(
+	const std::string & strKey,
+	const FileStat & filestat,
+	FileSummary & filesum
+) {
+	std::string strSummary;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		EntryMap::const_iterator iter = m_mapEntries.find(strKey);
+		if ((iter == m_mapEntries.end()) ||
+		    !(iter->second.m_filestat == filestat)
+		) {
+			m_sMisses++;
+			return false;
+		}
+		strSummary = iter->second.m_strSummary;
+	}
+
+	std::istringstream isSummary(strSummary);
+	bool fValid = filesum.Deserialize(isSummary);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!fValid) {
+		m_sMisses++;
+		return false;
+	}
+
+	m_mapEntries[strKey].m_fSeen = true;
+	m_sHits++;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FileSummaryCache::Insert(
+	const std::string & strKey,
+	const FileStat & filestat,
+	const FileSummary & filesum
+) {
+	std::ostringstream osSummary;
+	filesum.Serialize(osSummary);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	Entry & entry = m_mapEntries[strKey];
+	entry.m_filestat = filestat;
+	entry.m_strSummary = osSummary.str();
+	entry.m_fSeen = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
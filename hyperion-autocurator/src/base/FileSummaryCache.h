@@ -0,0 +1,213 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FileSummaryCache.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _FILESUMMARYCACHE_H_
+#define _FILESUMMARYCACHE_H_
+
+#include "FileSummary.h"
+
+#include <string>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Identity of a file on disk.  A cached FileSummary is only reused
+///		if the file still has the same identity.
+///	</summary>
+struct FileStat {
+
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FileStat() :
+		m_sSize(0),
+		m_iModTimeSec(0),
+		m_iModTimeNSec(0),
+		m_sInode(0),
+		m_sDevice(0)
+	{ }
+
+	///	<summary>
+	///		Populate from the given file.  Returns false if the file
+	///		does not exist.
+	///	</summary>
+	bool FromFile(
+		const std::string & strFullFilename
+	);
+
+	///	<summary>
+	///		Equality operator.
+	///	</summary>
+	bool operator==(const FileStat & filestat) const {
+		return (
+			(m_sSize == filestat.m_sSize) &&
+			(m_iModTimeSec == filestat.m_iModTimeSec) &&
+			(m_iModTimeNSec == filestat.m_iModTimeNSec) &&
+			(m_sInode == filestat.m_sInode) &&
+			(m_sDevice == filestat.m_sDevice));
+	}
+
+	///	<summary>
+	///		File size in bytes.
+	///	</summary>
+	uint64_t m_sSize;
+
+	///	<summary>
+	///		Modification time (seconds).
+	///	</summary>
+	int64_t m_iModTimeSec;
+
+	///	<summary>
+	///		Modification time (nanoseconds).
+	///	</summary>
+	int64_t m_iModTimeNSec;
+
+	///	<summary>
+	///		Inode number.
+	///	</summary>
+	uint64_t m_sInode;
+
+	///	<summary>
+	///		Device number.
+	///	</summary>
+	uint64_t m_sDevice;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A persistent cache of FileSummary objects, keyed by absolute path
+///		and validated against the size, modification time and inode of
+///		the file.  Lookup() and Insert() may be called concurrently.
+///	</summary>
+class FileSummaryCache {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FileSummaryCache() :
+		m_sHits(0),
+		m_sMisses(0)
+	{ }
+
+public:
+	///	<summary>
+	///		Load the cache from disk.  A missing cache file is not an
+	///		error.  Entries built with a different record dimension are
+	///		discarded.
+	///	</summary>
+	std::string Read(
+		const std::string & strCacheFile,
+		const std::string & strRecordDimName
+	);
+
+	///	<summary>
+	///		Write the cache to disk, keeping only the files looked up
+	///		or inserted since the cache was read.
+	///	</summary>
+	std::string Write(
+		const std::string & strCacheFile
+	) const;
+
+	///	<summary>
+	///		Find the FileSummary for the given file.  Returns false if
+	///		the file is not in the cache or has changed.
+	///	</summary>
+	bool Lookup(
+		const std::string & strKey,
+		const FileStat & filestat,
+		FileSummary & filesum
+	);
+
+	///	<summary>
+	///		Store the FileSummary for the given file.
+	///	</summary>
+	void Insert(
+		const std::string & strKey,
+		const FileStat & filestat,
+		const FileSummary & filesum
+	);
+
+	///	<summary>
+	///		Number of successful lookups.
+	///	</summary>
+	size_t GetHitCount() const {
+		return m_sHits;
+	}
+
+	///	<summary>
+	///		Number of failed lookups.
+	///	</summary>
+	size_t GetMissCount() const {
+		return m_sMisses;
+	}
+
+protected:
+	///	<summary>
+	///		A cached file identity and its serialized FileSummary.
+	///		Only entries found by Lookup() or stored by Insert() in this
+	///		run are written back.
+	///	</summary>
+	struct Entry {
+		Entry() :
+			m_fSeen(false)
+		{ }
+
+		FileStat m_filestat;
+		std::string m_strSummary;
+		bool m_fSeen;
+	};
+
+	///	<summary>
+	///		Map from absolute path to cache entry.
+	///	</summary>
+	typedef std::unordered_map<std::string, Entry> EntryMap;
+
+protected:
+	///	<summary>
+	///		Record dimension name used to build the summaries.
+	///	</summary>
+	std::string m_strRecordDimName;
+
+	///	<summary>
+	///		Cache entries.
+	///	</summary>
+	EntryMap m_mapEntries;
+
+	///	<summary>
+	///		Mutex guarding m_mapEntries and the counters.
+	///	</summary>
+	mutable std::mutex m_mutex;
+
+	///	<summary>
+	///		Number of successful lookups.
+	///	</summary>
+	size_t m_sHits;
+
+	///	<summary>
+	///		Number of failed lookups.
+	///	</summary>
+	size_t m_sMisses;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FilenameTable.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "FilenameTable.h"
+#include "Exception.h"
+
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FilenameTable::Clear() {
+	m_vecDirectories.clear();
+	m_mapDirectoryIx.clear();
+	m_vecFileDirectoryIx.clear();
+	m_vecBasenameBegin.clear();
+	m_vecBasenames.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t FilenameTable::Add(
+	const std::string & strFilename
+) {
+	size_t sBasenameBegin = strFilename.rfind('/');
+	if (sBasenameBegin == std::string::npos) {
+		sBasenameBegin = 0;
+	} else {
+		sBasenameBegin++;
+	}
+
+	// Find or add the directory
+	std::string strDirectory = strFilename.substr(0, sBasenameBegin);
+
+	std::unordered_map<std::string, uint32_t>::const_iterator iter =
+		m_mapDirectoryIx.find(strDirectory);
+
+	uint32_t iDirectory;
+	if (iter != m_mapDirectoryIx.end()) {
+		iDirectory = iter->second;
+
+	} else {
+		if (m_vecDirectories.size() >= static_cast<size_t>(UINT32_MAX)) {
+			_EXCEPTIONT("Too many directories in FilenameTable");
+		}
+		iDirectory = static_cast<uint32_t>(m_vecDirectories.size());
+		m_vecDirectories.push_back(strDirectory);
+		m_mapDirectoryIx.insert(
+			std::pair<std::string, uint32_t>(strDirectory, iDirectory));
+	}
+
+	// Append the basename
+	m_vecFileDirectoryIx.push_back(iDirectory);
+	m_vecBasenameBegin.push_back(m_vecBasenames.size());
+	m_vecBasenames.insert(
+		m_vecBasenames.end(),
+		strFilename.begin() + sBasenameBegin,
+		strFilename.end());
+	m_vecBasenames.push_back('\0');
+
+	return (m_vecFileDirectoryIx.size() - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t FilenameTable::Find(
+	const std::string & strFilename
+) const {
+	for (size_t f = 0; f < m_vecFileDirectoryIx.size(); f++) {
+		const std::string & strDirectory = GetDirectory(f);
+		if ((strFilename.compare(
+				0, strDirectory.length(), strDirectory) == 0) &&
+		    (strcmp(
+				strFilename.c_str() + strDirectory.length(),
+				GetBasename(f)) == 0)
+		) {
+			return f;
+		}
+	}
+	return GetCount();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FilenameTable::GetPath(
+	const std::string & strPrefix,
+	size_t f,
+	std::string & strPath
+) const {
+	if (f >= GetCount()) {
+		_EXCEPTIONT("Index out of range");
+	}
+
+	strPath.assign(strPrefix);
+	strPath.append(GetDirectory(f));
+	strPath.append(GetBasename(f));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FilenameTable::PrependDirectory(
+	const std::string & strPrefix
+) {
+	if (strPrefix == "") {
+		return;
+	}
+
+	// Every directory gains the same prefix, so they remain distinct
+	m_mapDirectoryIx.clear();
+	for (size_t d = 0; d < m_vecDirectories.size(); d++) {
+		m_vecDirectories[d] = strPrefix + m_vecDirectories[d];
+		m_mapDirectoryIx.insert(
+			std::pair<std::string, uint32_t>(
+				m_vecDirectories[d], static_cast<uint32_t>(d)));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
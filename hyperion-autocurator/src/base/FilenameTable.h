@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FilenameTable.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _FILENAMETABLE_H_
+#define _FILENAMETABLE_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		An indexed list of filenames.  Each filename is split into a
+///		directory, stored once in a table of directories, and a basename,
+///		stored NUL-terminated in a single contiguous buffer.  Each file
+///		costs a directory index and a buffer offset on top of its basename.
+///	</summary>
+class FilenameTable {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FilenameTable()
+	{ }
+
+public:
+	///	<summary>
+	///		Remove all filenames.
+	///	</summary>
+	void Clear();
+
+	///	<summary>
+	///		Get the number of filenames.
+	///	</summary>
+	size_t GetCount() const {
+		return m_vecFileDirectoryIx.size();
+	}
+
+	///	<summary>
+	///		Append a filename and return its index.
+	///	</summary>
+	size_t Add(
+		const std::string & strFilename
+	);
+
+	///	<summary>
+	///		Get the index of the given filename, or GetCount() if it is
+	///		not in the table.
+	///	</summary>
+	size_t Find(
+		const std::string & strFilename
+	) const;
+
+	///	<summary>
+	///		Get the directory of the filename with the given index.  The
+	///		filename is the directory followed by the basename.
+	///	</summary>
+	const std::string & GetDirectory(
+		size_t f
+	) const {
+		return m_vecDirectories[m_vecFileDirectoryIx[f]];
+	}
+
+	///	<summary>
+	///		Get the basename of the filename with the given index.
+	///	</summary>
+	const char * GetBasename(
+		size_t f
+	) const {
+		return &(m_vecBasenames[m_vecBasenameBegin[f]]);
+	}
+
+	///	<summary>
+	///		Get the filename with the given index.
+	///	</summary>
+	std::string Get(
+		size_t f
+	) const {
+		std::string strFilename;
+		GetPath("", f, strFilename);
+		return strFilename;
+	}
+
+	///	<summary>
+	///		Assemble strPrefix followed by the filename with the given
+	///		index into strPath, reusing its storage.
+	///	</summary>
+	void GetPath(
+		const std::string & strPrefix,
+		size_t f,
+		std::string & strPath
+	) const;
+
+	///	<summary>
+	///		Prepend strPrefix to every filename.
+	///	</summary>
+	void PrependDirectory(
+		const std::string & strPrefix
+	);
+
+protected:
+	///	<summary>
+	///		Distinct directories.
+	///	</summary>
+	std::vector<std::string> m_vecDirectories;
+
+	///	<summary>
+	///		A map from directory to index in m_vecDirectories.
+	///	</summary>
+	std::unordered_map<std::string, uint32_t> m_mapDirectoryIx;
+
+	///	<summary>
+	///		Index of the directory of each file.
+	///	</summary>
+	std::vector<uint32_t> m_vecFileDirectoryIx;
+
+	///	<summary>
+	///		Offset of the basename of each file in m_vecBasenames.
+	///	</summary>
+	std::vector<uint64_t> m_vecBasenameBegin;
+
+	///	<summary>
+	///		NUL-terminated basenames of all files.
+	///	</summary>
+	std::vector<char> m_vecBasenames;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
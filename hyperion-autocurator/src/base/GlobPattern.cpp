@@ -0,0 +1,358 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    GlobPattern.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "GlobPattern.h"
+
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Number of distinct characters.
+///	</summary>
+static const size_t CharCount = 256;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Find the end of the bracket expression that begins at sBegin.
+///		Returns std::string::npos if the bracket is not closed.
+///	</summary>
+static size_t FindBracketEnd(
+	const std::string & strPattern,
+	size_t sBegin
+) {
+	size_t i = sBegin + 1;
+	if ((i < strPattern.length()) &&
+	    ((strPattern[i] == '!') || (strPattern[i] == '^'))
+	) {
+		i++;
+	}
+
+	// A ']' immediately after the opening bracket is a literal
+	if ((i < strPattern.length()) && (strPattern[i] == ']')) {
+		i++;
+	}
+	for (; i < strPattern.length(); i++) {
+		if (strPattern[i] == ']') {
+			return i;
+		}
+	}
+	return std::string::npos;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Expand the first top-level brace expression of a pattern
+///		(recursively) into a list of patterns without braces.
+///	</summary>
+static void ExpandBraces(
+	const std::string & strPattern,
+	std::vector<std::string> & vecExpanded
+) {
+	// Find the first brace expression and its top-level commas
+	size_t sOpen = std::string::npos;
+	std::vector<size_t> vecSeparators;
+	int nDepth = 0;
+
+	for (size_t i = 0; i < strPattern.length(); i++) {
+		char c = strPattern[i];
+		if (c == '\\') {
+			i++;
+
+		} else if (c == '[') {
+			size_t sEnd = FindBracketEnd(strPattern, i);
+			if (sEnd != std::string::npos) {
+				i = sEnd;
+			}
+
+		} else if (c == '{') {
+			if (nDepth == 0) {
+				sOpen = i;
+				vecSeparators.clear();
+				vecSeparators.push_back(i);
+			}
+			nDepth++;
+
+		} else if ((c == ',') && (nDepth == 1)) {
+			vecSeparators.push_back(i);
+
+		} else if ((c == '}') && (nDepth != 0)) {
+			nDepth--;
+			if (nDepth == 0) {
+				vecSeparators.push_back(i);
+
+				std::string strHead = strPattern.substr(0, sOpen);
+				std::string strTail = strPattern.substr(i+1);
+				for (size_t s = 0; s < vecSeparators.size()-1; s++) {
+					ExpandBraces(
+						strHead
+						+ strPattern.substr(
+							vecSeparators[s]+1,
+							vecSeparators[s+1] - vecSeparators[s] - 1)
+						+ strTail,
+						vecExpanded);
+				}
+				return;
+			}
+		}
+	}
+
+	// No (closed) brace expression
+	vecExpanded.push_back(strPattern);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool GlobPattern::ContainsWildcard(
+	const std::string & strPattern
+) {
+	return (strPattern.find_first_of("*?[{\\") != std::string::npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GlobPattern::Compile(
+	const std::string & strPattern
+) {
+	std::vector<std::string> vecExpanded;
+	ExpandBraces(strPattern, vecExpanded);
+
+	m_vecAlternatives.resize(vecExpanded.size());
+	for (size_t a = 0; a < vecExpanded.size(); a++) {
+		CompileAlternative(vecExpanded[a], m_vecAlternatives[a]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GlobPattern::CompileAlternative(
+	const std::string & strPattern,
+	Alternative & alt
+) {
+	// Parse the pattern into a sequence of character classes, noting which
+	// classes are preceded by '*' and which are single literal characters
+	std::vector< std::vector<bool> > vecClasses;
+	std::vector<bool> vecStar;
+	std::vector<int> vecLiteral;
+
+	bool fStar = false;
+
+	for (size_t i = 0; i < strPattern.length(); i++) {
+		char c = strPattern[i];
+
+		if (c == '*') {
+			fStar = true;
+			continue;
+		}
+
+		std::vector<bool> vecClass(CharCount, false);
+		int iLiteral = (-1);
+
+		if (c == '?') {
+			vecClass.assign(CharCount, true);
+
+		} else if ((c == '[') &&
+		           (FindBracketEnd(strPattern, i) != std::string::npos)
+		) {
+			size_t sEnd = FindBracketEnd(strPattern, i);
+			size_t j = i + 1;
+			bool fNegate = false;
+			if ((strPattern[j] == '!') || (strPattern[j] == '^')) {
+				fNegate = true;
+				j++;
+			}
+			for (size_t k = j; k < sEnd; k++) {
+				unsigned char cBegin = strPattern[k];
+				unsigned char cEnd = cBegin;
+				if ((k+2 < sEnd) && (strPattern[k+1] == '-')) {
+					cEnd = strPattern[k+2];
+					k += 2;
+				}
+				for (unsigned int ch = cBegin; ch <= cEnd; ch++) {
+					vecClass[ch] = true;
+				}
+			}
+			if (fNegate) {
+				vecClass.flip();
+			}
+			i = sEnd;
+
+		} else {
+			if ((c == '\\') && (i+1 < strPattern.length())) {
+				i++;
+				c = strPattern[i];
+			}
+			vecClass[static_cast<unsigned char>(c)] = true;
+			iLiteral = static_cast<unsigned char>(c);
+		}
+
+		vecClasses.push_back(vecClass);
+		vecStar.push_back(fStar);
+		vecLiteral.push_back(iLiteral);
+		fStar = false;
+	}
+
+	// Trailing '*' applies to the accepting state
+	vecStar.push_back(fStar);
+
+	const size_t sStates = vecClasses.size();
+
+	alt.m_sStates = sStates;
+	alt.m_sWords = (sStates + 1 + 63) / 64;
+	alt.m_sMinLength = sStates;
+	alt.m_fHasStar = false;
+	for (size_t i = 0; i <= sStates; i++) {
+		if (vecStar[i]) {
+			alt.m_fHasStar = true;
+		}
+	}
+
+	// Literal prefix (before any '*' or class)
+	alt.m_strPrefix = "";
+	for (size_t i = 0; i < sStates; i++) {
+		if (vecStar[i] || (vecLiteral[i] == (-1))) {
+			break;
+		}
+		alt.m_strPrefix += static_cast<char>(vecLiteral[i]);
+	}
+	alt.m_fLiteral =
+		(!alt.m_fHasStar) && (alt.m_strPrefix.length() == sStates);
+
+	// Literal suffix (after the last '*' or class)
+	alt.m_strSuffix = "";
+	if (!vecStar[sStates]) {
+		size_t i = sStates;
+		for (; i > 0; i--) {
+			if (vecLiteral[i-1] == (-1)) {
+				break;
+			}
+			if (vecStar[i-1]) {
+				i--;
+				break;
+			}
+		}
+		for (size_t k = i; k < sStates; k++) {
+			alt.m_strSuffix += static_cast<char>(vecLiteral[k]);
+		}
+	}
+
+	// Build the NFA masks
+	alt.m_vecCharMask.assign(CharCount * alt.m_sWords, 0);
+	alt.m_vecStarMask.assign(alt.m_sWords, 0);
+
+	for (size_t i = 0; i < sStates; i++) {
+		uint64_t iBit = static_cast<uint64_t>(1) << (i % 64);
+		for (size_t c = 0; c < CharCount; c++) {
+			if (vecClasses[i][c]) {
+				alt.m_vecCharMask[c * alt.m_sWords + i / 64] |= iBit;
+			}
+		}
+	}
+	for (size_t i = 0; i <= sStates; i++) {
+		if (vecStar[i]) {
+			alt.m_vecStarMask[i / 64] |= static_cast<uint64_t>(1) << (i % 64);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool GlobPattern::MatchesAlternative(
+	const Alternative & alt,
+	const char * szString,
+	size_t sLength
+) {
+	// Fast rejection on length and literal prefix and suffix
+	if (sLength < alt.m_sMinLength) {
+		return false;
+	}
+	if ((!alt.m_fHasStar) && (sLength != alt.m_sMinLength)) {
+		return false;
+	}
+	if (memcmp(szString, alt.m_strPrefix.c_str(), alt.m_strPrefix.length()) != 0) {
+		return false;
+	}
+	if (alt.m_fLiteral) {
+		return true;
+	}
+	if (sLength < alt.m_strSuffix.length()) {
+		return false;
+	}
+	if (memcmp(
+			szString + sLength - alt.m_strSuffix.length(),
+			alt.m_strSuffix.c_str(),
+			alt.m_strSuffix.length()) != 0
+	) {
+		return false;
+	}
+
+	// Simulate the NFA.  State i means the first i classes have been
+	// matched; a state preceded by '*' may also consume any character.
+	const size_t sWords = alt.m_sWords;
+
+	uint64_t iStackState[4];
+	std::vector<uint64_t> vecHeapState;
+	uint64_t * piState = iStackState;
+	if (sWords > 4) {
+		vecHeapState.resize(sWords);
+		piState = &(vecHeapState[0]);
+	}
+
+	memset(piState, 0, sWords * sizeof(uint64_t));
+	piState[0] = 1;
+
+	for (size_t s = 0; s < sLength; s++) {
+		const uint64_t * piCharMask =
+			&(alt.m_vecCharMask[
+				static_cast<unsigned char>(szString[s]) * sWords]);
+
+		uint64_t iAny = 0;
+		uint64_t iCarry = 0;
+		for (size_t w = 0; w < sWords; w++) {
+			uint64_t iAdvance = piState[w] & piCharMask[w];
+			uint64_t iNext =
+				(iAdvance << 1) | iCarry
+				| (piState[w] & alt.m_vecStarMask[w]);
+			iCarry = iAdvance >> 63;
+			piState[w] = iNext;
+			iAny |= iNext;
+		}
+		if (iAny == 0) {
+			return false;
+		}
+	}
+
+	return ((piState[alt.m_sStates / 64] >> (alt.m_sStates % 64)) & 1) != 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool GlobPattern::Matches(
+	const char * szString,
+	size_t sLength
+) const {
+	for (size_t a = 0; a < m_vecAlternatives.size(); a++) {
+		if (MatchesAlternative(m_vecAlternatives[a], szString, sLength)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    GlobPattern.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _GLOBPATTERN_H_
+#define _GLOBPATTERN_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A compiled shell-style wildcard pattern.  Supported syntax:
+///		- '*' matches any sequence of characters
+///		- '?' matches any single character
+///		- "[abc]", "[a-z]", "[!abc]" and "[^abc]" match a character class
+///		- "{a,b,c}" matches any of the comma-separated alternatives
+///		- '\' matches the following character literally
+///		Matching simulates the pattern as a bit-parallel NFA, so the cost
+///		is linear in the length of the string for any pattern.
+///	</summary>
+class GlobPattern {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	GlobPattern() { }
+
+	///	<summary>
+	///		Constructor from a pattern.
+	///	</summary>
+	GlobPattern(
+		const std::string & strPattern
+	) {
+		Compile(strPattern);
+	}
+
+public:
+	///	<summary>
+	///		Check if the given string contains any wildcard characters.
+	///	</summary>
+	static bool ContainsWildcard(
+		const std::string & strPattern
+	);
+
+	///	<summary>
+	///		Compile the given pattern.
+	///	</summary>
+	void Compile(
+		const std::string & strPattern
+	);
+
+	///	<summary>
+	///		Check if the given string matches the pattern.
+	///	</summary>
+	bool Matches(
+		const char * szString,
+		size_t sLength
+	) const;
+
+	///	<summary>
+	///		Check if the given string matches the pattern.
+	///	</summary>
+	bool Matches(
+		const std::string & str
+	) const {
+		return Matches(str.c_str(), str.length());
+	}
+
+protected:
+	///	<summary>
+	///		A single alternative of the pattern without braces, compiled
+	///		into an NFA with one state per non-'*' character class.
+	///	</summary>
+	struct Alternative {
+
+		///	<summary>
+		///		Literal characters that every match begins with.
+		///	</summary>
+		std::string m_strPrefix;
+
+		///	<summary>
+		///		Literal characters that every match ends with.
+		///	</summary>
+		std::string m_strSuffix;
+
+		///	<summary>
+		///		Minimum length of a match.
+		///	</summary>
+		size_t m_sMinLength;
+
+		///	<summary>
+		///		Flag indicating the pattern contains '*'.
+		///	</summary>
+		bool m_fHasStar;
+
+		///	<summary>
+		///		Flag indicating the pattern is entirely literal.
+		///	</summary>
+		bool m_fLiteral;
+
+		///	<summary>
+		///		Number of NFA states (excluding the accepting state).
+		///	</summary>
+		size_t m_sStates;
+
+		///	<summary>
+		///		Number of 64-bit words in a state set.
+		///	</summary>
+		size_t m_sWords;
+
+		///	<summary>
+		///		For each character, the set of states that consume it.
+		///	</summary>
+		std::vector<uint64_t> m_vecCharMask;
+
+		///	<summary>
+		///		The set of states preceded by '*', which may consume any
+		///		number of characters before advancing.
+		///	</summary>
+		std::vector<uint64_t> m_vecStarMask;
+	};
+
+	///	<summary>
+	///		Compile a pattern without braces into an Alternative.
+	///	</summary>
+	static void CompileAlternative(
+		const std::string & strPattern,
+		Alternative & alt
+	);
+
+	///	<summary>
+	///		Check if a string matches an Alternative.
+	///	</summary>
+	static bool MatchesAlternative(
+		const Alternative & alt,
+		const char * szString,
+		size_t sLength
+	);
+
+protected:
+	///	<summary>
+	///		Alternatives obtained by expanding braces.
+	///	</summary>
+	std::vector<Alternative> m_vecAlternatives;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
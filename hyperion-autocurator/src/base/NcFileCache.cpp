@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    NcFileCache.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "NcFileCache.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+NcFile * NcFileCache::Get(
+	const std::string & strFilename
+) {
+	std::unordered_map<std::string, std::list<FileHandlePair>::iterator>::iterator
+		iter = m_mapFiles.find(strFilename);
+
+	// Move an open file to the front of the list
+	if (iter != m_mapFiles.end()) {
+		m_lstFiles.splice(m_lstFiles.begin(), m_lstFiles, iter->second);
+		return m_lstFiles.front().second;
+	}
+
+	// Make room for and open a new file
+	Trim(m_sMaxOpen - 1);
+
+	NcFile * pncfile = new NcFile(strFilename.c_str(), m_eMode);
+	if (!pncfile->is_valid()) {
+		delete pncfile;
+		return NULL;
+	}
+
+	m_lstFiles.push_front(FileHandlePair(strFilename, pncfile));
+	m_mapFiles.insert(
+		std::pair<std::string, std::list<FileHandlePair>::iterator>(
+			strFilename, m_lstFiles.begin()));
+
+	return pncfile;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void NcFileCache::Close(
+	const std::string & strFilename
+) {
+	std::unordered_map<std::string, std::list<FileHandlePair>::iterator>::iterator
+		iter = m_mapFiles.find(strFilename);
+
+	if (iter != m_mapFiles.end()) {
+		delete iter->second->second;
+		m_lstFiles.erase(iter->second);
+		m_mapFiles.erase(iter);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void NcFileCache::CloseAll() {
+	Trim(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void NcFileCache::Trim(
+	size_t sOpen
+) {
+	while (m_lstFiles.size() > sOpen) {
+		delete m_lstFiles.back().second;
+		m_mapFiles.erase(m_lstFiles.back().first);
+		m_lstFiles.pop_back();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
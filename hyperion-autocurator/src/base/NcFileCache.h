@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    NcFileCache.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _NCFILECACHE_H_
+#define _NCFILECACHE_H_
+
+#include "netcdfcpp.h"
+
+#include <string>
+#include <list>
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A bounded set of open NcFile handles, all opened with the same
+///		FileMode, keyed by filename.  When the cache is full the least
+///		recently used handle is closed.  The cache is not thread-safe.
+///	</summary>
+class NcFileCache {
+
+public:
+	///	<summary>
+	///		Default maximum number of open files.
+	///	</summary>
+	static const size_t DefaultMaxOpen = 16;
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	NcFileCache(
+		NcFile::FileMode eMode,
+		size_t sMaxOpen = DefaultMaxOpen
+	) :
+		m_eMode(eMode),
+		m_sMaxOpen((sMaxOpen == 0)?(1):(sMaxOpen))
+	{ }
+
+	///	<summary>
+	///		Destructor.  All open files are closed.
+	///	</summary>
+	~NcFileCache() {
+		CloseAll();
+	}
+
+private:
+	///	<summary>
+	///		Copy constructor (disabled).
+	///	</summary>
+	NcFileCache(const NcFileCache &) = delete;
+
+	///	<summary>
+	///		Assignment operator (disabled).
+	///	</summary>
+	NcFileCache & operator=(const NcFileCache &) = delete;
+
+public:
+	///	<summary>
+	///		Get an open handle to the given file, opening it if it is not
+	///		in the cache.  Returns NULL if the file cannot be opened.  The
+	///		handle remains valid until the next call to Get(), Close()
+	///		or CloseAll().
+	///	</summary>
+	NcFile * Get(
+		const std::string & strFilename
+	);
+
+	///	<summary>
+	///		Close the given file if it is in the cache.
+	///	</summary>
+	void Close(
+		const std::string & strFilename
+	);
+
+	///	<summary>
+	///		Close all files in the cache.
+	///	</summary>
+	void CloseAll();
+
+protected:
+	///	<summary>
+	///		Close least recently used files until at most sOpen are open.
+	///	</summary>
+	void Trim(
+		size_t sOpen
+	);
+
+protected:
+	///	<summary>
+	///		A filename and its open handle.
+	///	</summary>
+	typedef std::pair<std::string, NcFile *> FileHandlePair;
+
+	///	<summary>
+	///		Mode used to open files.
+	///	</summary>
+	NcFile::FileMode m_eMode;
+
+	///	<summary>
+	///		Maximum number of open files.
+	///	</summary>
+	size_t m_sMaxOpen;
+
+	///	<summary>
+	///		Open files, most recently used first.
+	///	</summary>
+	std::list<FileHandlePair> m_lstFiles;
+
+	///	<summary>
+	///		A map from filename to position in m_lstFiles.
+	///	</summary>
+	std::unordered_map<std::string, std::list<FileHandlePair>::iterator>
+		m_mapFiles;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -15,11 +15,61 @@
 ///	</remarks>
 
 #include "NetCDFUtilities.h"
+#include "AttributeValue.h"
 #include "Exception.h"
 #include "DataArray1D.h"
 #include "netcdfcpp.h"
 
 #include <vector>
+#include <cstdio>
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::mutex & GetNetCDFMutex() {
+	static std::mutex s_mutexNetCDF;
+	return s_mutexNetCDF;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+size_t SetNetCDFOpenMode(
+	NetCDFOpenMode eOpenMode
+) {
+	// Read buffer size used for metadata scans
+	static const size_t MetadataScanBufferSize = 8192;
+
+	// Default chunk cache parameters of the library
+	static bool s_fInitialized = false;
+	static NetCDFOpenMode s_eOpenMode = NetCDFOpenDefault;
+	static size_t s_sChunkCacheSize = 0;
+	static size_t s_sChunkCacheElements = 0;
+	static float s_flChunkCachePreemption = 0.75f;
+
+	if (!s_fInitialized) {
+		nc_get_chunk_cache(
+			&s_sChunkCacheSize,
+			&s_sChunkCacheElements,
+			&s_flChunkCachePreemption);
+		s_fInitialized = true;
+	}
+
+	if (eOpenMode != s_eOpenMode) {
+		if (eOpenMode == NetCDFOpenMetadataScan) {
+			nc_set_chunk_cache(0, 0, s_flChunkCachePreemption);
+		} else {
+			nc_set_chunk_cache(
+				s_sChunkCacheSize,
+				s_sChunkCacheElements,
+				s_flChunkCachePreemption);
+		}
+		s_eOpenMode = eOpenMode;
+	}
+
+	if (eOpenMode == NetCDFOpenMetadataScan) {
+		return MetadataScanBufferSize;
+	}
+	return 0;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -111,6 +161,212 @@ std::string NcTypeToString(
 
 ////////////////////////////////////////////////////////////////////////////////
 
+int GetNcAttCount(
+	int iNcId,
+	int iVarId
+) {
+	int nAtts;
+	int status;
+	if (iVarId == NC_GLOBAL) {
+		status = nc_inq_natts(iNcId, &nAtts);
+	} else {
+		status = nc_inq_varnatts(iNcId, iVarId, &nAtts);
+	}
+	if (status != NC_NOERR) {
+		return (-1);
+	}
+	return nAtts;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetNcAttName(
+	int iNcId,
+	int iVarId,
+	int iAtt,
+	std::string & strAttName
+) {
+	char szAttName[NC_MAX_NAME+1];
+	if (nc_inq_attname(iNcId, iVarId, iAtt, szAttName) != NC_NOERR) {
+		return false;
+	}
+	strAttName.assign(szAttName);
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Read the value of an attribute with nc_get_att_* into a buffer
+///		owned by the calling thread.  Returns NULL on error or if the
+///		attribute is of a type AttributeValue does not support.
+///	</summary>
+static const void * ReadNcAtt(
+	int iNcId,
+	int iVarId,
+	const char * szAttName,
+	nc_type & nctype,
+	size_t & sLength
+) {
+	// Buffer for attribute values, reused across calls on this thread
+	static thread_local std::vector<char> s_vecBuffer(1);
+
+	if (nc_inq_att(iNcId, iVarId, szAttName, &nctype, &sLength) != NC_NOERR) {
+		return NULL;
+	}
+
+	size_t sTypeSize = AttributeValue::GetTypeSize(static_cast<NcType>(nctype));
+	if (sTypeSize == 0) {
+		return NULL;
+	}
+	if (sLength == 0) {
+		return &(s_vecBuffer[0]);
+	}
+	if (s_vecBuffer.size() < sLength * sTypeSize) {
+		s_vecBuffer.resize(sLength * sTypeSize);
+	}
+	void * pBuffer = &(s_vecBuffer[0]);
+
+	int status = NC_NOERR;
+	switch (nctype) {
+		case NC_BYTE:
+			status = nc_get_att_schar(iNcId, iVarId, szAttName,
+				static_cast<signed char *>(pBuffer));
+			break;
+		case NC_CHAR:
+			status = nc_get_att_text(iNcId, iVarId, szAttName,
+				static_cast<char *>(pBuffer));
+			break;
+		case NC_SHORT:
+			status = nc_get_att_short(iNcId, iVarId, szAttName,
+				static_cast<short *>(pBuffer));
+			break;
+		case NC_INT:
+			status = nc_get_att_int(iNcId, iVarId, szAttName,
+				static_cast<int *>(pBuffer));
+			break;
+		case NC_FLOAT:
+			status = nc_get_att_float(iNcId, iVarId, szAttName,
+				static_cast<float *>(pBuffer));
+			break;
+		case NC_DOUBLE:
+			status = nc_get_att_double(iNcId, iVarId, szAttName,
+				static_cast<double *>(pBuffer));
+			break;
+		case NC_UBYTE:
+			status = nc_get_att_uchar(iNcId, iVarId, szAttName,
+				static_cast<unsigned char *>(pBuffer));
+			break;
+		case NC_USHORT:
+			status = nc_get_att_ushort(iNcId, iVarId, szAttName,
+				static_cast<unsigned short *>(pBuffer));
+			break;
+		case NC_UINT:
+			status = nc_get_att_uint(iNcId, iVarId, szAttName,
+				static_cast<unsigned int *>(pBuffer));
+			break;
+		case NC_INT64:
+			status = nc_get_att_longlong(iNcId, iVarId, szAttName,
+				static_cast<long long *>(pBuffer));
+			break;
+		case NC_UINT64:
+			status = nc_get_att_ulonglong(iNcId, iVarId, szAttName,
+				static_cast<unsigned long long *>(pBuffer));
+			break;
+	}
+	if (status != NC_NOERR) {
+		return NULL;
+	}
+	return pBuffer;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool GetNcAttValue(
+	int iNcId,
+	int iVarId,
+	const char * szAttName,
+	AttributeValue & value
+) {
+	nc_type nctype;
+	size_t sLength;
+	const void * pData = ReadNcAtt(iNcId, iVarId, szAttName, nctype, sLength);
+	if (pData == NULL) {
+		return false;
+	}
+	value.Set(static_cast<NcType>(nctype), sLength, pData);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool GetNcAttAsString(
+	int iNcId,
+	int iVarId,
+	const char * szAttName,
+	std::string & strValue
+) {
+	strValue.clear();
+
+	nc_type nctype;
+	size_t sLength;
+	const void * pData = ReadNcAtt(iNcId, iVarId, szAttName, nctype, sLength);
+	if (pData == NULL) {
+		return false;
+	}
+	if (sLength == 0) {
+		return true;
+	}
+
+	// Character data is truncated at the first NUL
+	if ((nctype == NC_BYTE) || (nctype == NC_CHAR)) {
+		const char * sz = static_cast<const char *>(pData);
+		size_t sTextLength = 0;
+		while ((sTextLength < sLength) && (sz[sTextLength] != '\0')) {
+			sTextLength++;
+		}
+		strValue.assign(sz, sTextLength);
+		return true;
+	}
+
+	// Numeric data is formatted as std::ostream would format its first
+	// element, which for floating point types is "%g"
+	char szValue[64];
+	switch (nctype) {
+		case NC_SHORT:
+			snprintf(szValue, sizeof(szValue), "%hd",
+				*static_cast<const short *>(pData));
+			break;
+		case NC_INT:
+			snprintf(szValue, sizeof(szValue), "%d",
+				*static_cast<const int *>(pData));
+			break;
+		case NC_FLOAT:
+			snprintf(szValue, sizeof(szValue), "%g",
+				static_cast<double>(*static_cast<const float *>(pData)));
+			break;
+		case NC_DOUBLE:
+			snprintf(szValue, sizeof(szValue), "%g",
+				*static_cast<const double *>(pData));
+			break;
+		case NC_INT64:
+			snprintf(szValue, sizeof(szValue), "%lld",
+				*static_cast<const long long *>(pData));
+			break;
+		case NC_UINT64:
+			snprintf(szValue, sizeof(szValue), "%llu",
+				*static_cast<const unsigned long long *>(pData));
+			break;
+		default:
+			return false;
+	}
+
+	strValue.assign(szValue);
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void CopyNcFileAttributes(
 	NcFile * fileIn,
 	NcFile * fileOut
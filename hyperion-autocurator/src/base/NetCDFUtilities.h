@@ -18,8 +18,41 @@
 #define _NETCDFUTILITIES_H_
 
 #include <string>
+#include <mutex>
 #include "netcdfcpp.h"
 
+class AttributeValue;
+
+////////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Get the mutex that serializes access to the NetCDF library, which
+///		is not thread-safe.
+///	</summary>
+std::mutex & GetNetCDFMutex();
+
+////////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Ways of opening a NcFile.
+///	</summary>
+enum NetCDFOpenMode {
+	NetCDFOpenDefault,
+	NetCDFOpenMetadataScan
+};
+
+///	<summary>
+///		Configure the NetCDF library for opening files with the given mode
+///		and return the buffer size hint to pass to the NcFile constructor.
+///		NetCDFOpenMetadataScan disables the netCDF-4 chunk cache, which is
+///		otherwise allocated for every variable, and requests a small read
+///		buffer for classic files.  Must be called with GetNetCDFMutex()
+///		held.
+///	</summary>
+size_t SetNetCDFOpenMode(
+	NetCDFOpenMode eOpenMode
+);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ///	<summary>
@@ -40,6 +73,56 @@ std::string NcTypeToString(
 
 ////////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Get the number of attributes of the variable with the given id,
+///		or of the file if iVarId is NC_GLOBAL.  Returns (-1) on error.
+///	</summary>
+int GetNcAttCount(
+	int iNcId,
+	int iVarId
+);
+
+///	<summary>
+///		Get the name of the attribute with the given index.
+///	</summary>
+bool GetNcAttName(
+	int iNcId,
+	int iVarId,
+	int iAtt,
+	std::string & strAttName
+);
+
+///	<summary>
+///		Get the typed value of an attribute.  Returns false if the
+///		attribute does not exist, cannot be read or is of a type
+///		AttributeValue does not support.  Must be called with
+///		GetNetCDFMutex() held.
+///	</summary>
+bool GetNcAttValue(
+	int iNcId,
+	int iVarId,
+	const char * szAttName,
+	AttributeValue & value
+);
+
+///	<summary>
+///		Get the value of an attribute formatted as NcAtt::as_string(0)
+///		would: character data up to the first NUL, or the first element
+///		of numeric data.  Values are read with nc_get_att_* into a buffer
+///		owned by the calling thread, so no NcAtt or NcValues is allocated.
+///		Returns false if the attribute does not exist, cannot be read or
+///		is of a type NcAtt does not support.  Must be called with
+///		GetNetCDFMutex() held.
+///	</summary>
+bool GetNcAttAsString(
+	int iNcId,
+	int iVarId,
+	const char * szAttName,
+	std::string & strValue
+);
+
+////////////////////////////////////////////////////////////////////////////////
+
 void CopyNcFileAttributes(
 	NcFile * fileIn,
 	NcFile * fileOut
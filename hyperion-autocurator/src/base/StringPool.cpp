@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    StringPool.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "StringPool.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+StringPool & StringPool::GetGlobal() {
+	static StringPool s_pool;
+	return s_pool;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+const std::string * StringPool::GetEmpty() {
+	static const std::string s_strEmpty;
+	return &s_strEmpty;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+const std::string * StringPool::Intern(
+	const std::string & str
+) {
+	if (str.empty()) {
+		return GetEmpty();
+	}
+
+	Shard & shard = m_shards[std::hash<std::string>()(str) % ShardCount];
+
+	std::lock_guard<std::mutex> lock(shard.m_mutex);
+
+	std::pair<std::unordered_set<std::string>::iterator, bool> prInsert =
+		shard.m_setStrings.insert(str);
+
+	return &(*(prInsert.first));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t StringPool::GetSize() const {
+	size_t sSize = 0;
+	for (size_t s = 0; s < ShardCount; s++) {
+		std::lock_guard<std::mutex> lock(m_shards[s].m_mutex);
+		sSize += m_shards[s].m_setStrings.size();
+	}
+	return sSize;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
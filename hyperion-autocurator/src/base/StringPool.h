@@ -0,0 +1,214 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    StringPool.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _STRINGPOOL_H_
+#define _STRINGPOOL_H_
+
+#include <string>
+#include <mutex>
+#include <unordered_set>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A set of distinct strings.  Each string is stored once and its
+///		address does not change until the pool is destroyed.  Interning
+///		is thread safe; strings are split across shards by hash, each
+///		with its own mutex, so concurrent threads seldom wait.
+///	</summary>
+class StringPool {
+
+public:
+	///	<summary>
+	///		Number of shards.
+	///	</summary>
+	static const size_t ShardCount = 16;
+
+public:
+	///	<summary>
+	///		Get the pool used by InternedString.
+	///	</summary>
+	static StringPool & GetGlobal();
+
+	///	<summary>
+	///		Get the pooled copy of the empty string.
+	///	</summary>
+	static const std::string * GetEmpty();
+
+public:
+	///	<summary>
+	///		Get the pooled copy of the given string, adding it to the
+	///		pool if it is not already present.
+	///	</summary>
+	const std::string * Intern(
+		const std::string & str
+	);
+
+	///	<summary>
+	///		Get the number of strings in the pool.
+	///	</summary>
+	size_t GetSize() const;
+
+protected:
+	///	<summary>
+	///		A subset of the pooled strings.
+	///	</summary>
+	class Shard {
+	public:
+		///	<summary>
+		///		Mutex guarding m_setStrings.
+		///	</summary>
+		mutable std::mutex m_mutex;
+
+		///	<summary>
+		///		Pooled strings.  Elements of an unordered_set are not
+		///		moved when the set is rehashed.
+		///	</summary>
+		std::unordered_set<std::string> m_setStrings;
+	};
+
+protected:
+	///	<summary>
+	///		Shards of the pool.
+	///	</summary>
+	Shard m_shards[ShardCount];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A handle to a string in the global StringPool.  Equal strings
+///		share one pooled copy, so handles are compared by address.
+///	</summary>
+class InternedString {
+
+public:
+	///	<summary>
+	///		Constructor (empty string).
+	///	</summary>
+	InternedString() :
+		m_pstr(StringPool::GetEmpty())
+	{ }
+
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	explicit InternedString(
+		const std::string & str
+	) :
+		m_pstr(StringPool::GetGlobal().Intern(str))
+	{ }
+
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	explicit InternedString(
+		const char * sz
+	) :
+		m_pstr(StringPool::GetGlobal().Intern(std::string(sz)))
+	{ }
+
+public:
+	///	<summary>
+	///		Get the string.
+	///	</summary>
+	const std::string & str() const {
+		return (*m_pstr);
+	}
+
+	///	<summary>
+	///		Get the string as a C string.
+	///	</summary>
+	const char * c_str() const {
+		return m_pstr->c_str();
+	}
+
+	///	<summary>
+	///		Check if the string is empty.
+	///	</summary>
+	bool empty() const {
+		return m_pstr->empty();
+	}
+
+	///	<summary>
+	///		Get a hash of the handle.  Equal strings have equal hashes,
+	///		but hashes differ between processes.
+	///	</summary>
+	size_t GetHash() const {
+		return reinterpret_cast<size_t>(m_pstr);
+	}
+
+public:
+	///	<summary>
+	///		Equality operator.
+	///	</summary>
+	bool operator==(const InternedString & istr) const {
+		return (m_pstr == istr.m_pstr);
+	}
+
+	///	<summary>
+	///		Inequality operator.
+	///	</summary>
+	bool operator!=(const InternedString & istr) const {
+		return (m_pstr != istr.m_pstr);
+	}
+
+	///	<summary>
+	///		Comparator, ordering handles by their strings.
+	///	</summary>
+	bool operator<(const InternedString & istr) const {
+		return ((m_pstr != istr.m_pstr) && ((*m_pstr) < (*istr.m_pstr)));
+	}
+
+	///	<summary>
+	///		Equality operator with a string that need not be interned.
+	///	</summary>
+	bool operator==(const std::string & str) const {
+		return ((*m_pstr) == str);
+	}
+
+	///	<summary>
+	///		Inequality operator with a string that need not be interned.
+	///	</summary>
+	bool operator!=(const std::string & str) const {
+		return ((*m_pstr) != str);
+	}
+
+	///	<summary>
+	///		Equality operator with a C string.
+	///	</summary>
+	bool operator==(const char * sz) const {
+		return ((*m_pstr) == sz);
+	}
+
+	///	<summary>
+	///		Inequality operator with a C string.
+	///	</summary>
+	bool operator!=(const char * sz) const {
+		return ((*m_pstr) != sz);
+	}
+
+protected:
+	///	<summary>
+	///		Pooled string.
+	///	</summary>
+	const std::string * m_pstr;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -0,0 +1,307 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    TimeAxis.cpp
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "TimeAxis.h"
+#include "Exception.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+const size_t TimeAxis::InvalidTimeIx = (-1);
+
+///////////////////////////////////////////////////////////////////////////////
+
+TimeAxis & TimeAxis::operator=(const TimeAxis & axis) {
+	if (this == &axis) {
+		return (*this);
+	}
+
+	m_sCount = axis.m_sCount;
+	m_mapSegments = axis.m_mapSegments;
+	RebuildIndexMap();
+
+	return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TimeAxis::Clear() {
+	m_sCount = 0;
+	m_mapSegments.clear();
+	m_mapIxToSegment.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+Time TimeAxis::GetTime(size_t sTimeIx) const {
+	if (sTimeIx >= m_sCount) {
+		_EXCEPTIONT("Index out of range");
+	}
+
+	std::map<size_t, Segment *>::const_iterator iter =
+		m_mapIxToSegment.upper_bound(sTimeIx);
+	iter--;
+
+	const Segment & seg = *(iter->second);
+	return GetSegmentTime(seg, sTimeIx - seg.m_sIxBegin);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t TimeAxis::Find(const Time & time) const {
+	int64_t iKey = time.GetKey();
+
+	const Segment * pseg = FindSegment(iKey);
+	if (pseg == NULL) {
+		return InvalidTimeIx;
+	}
+
+	int64_t iOffset = iKey - pseg->m_iKeyBegin;
+	if (iOffset == 0) {
+		return pseg->m_sIxBegin;
+	}
+	if (iOffset % pseg->m_iKeyStep != 0) {
+		return InvalidTimeIx;
+	}
+	return pseg->m_sIxBegin + static_cast<size_t>(iOffset / pseg->m_iKeyStep);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t TimeAxis::Insert(
+	const Time & time,
+	bool & fInserted
+) {
+	fInserted = false;
+
+	int64_t iKey = time.GetKey();
+
+	// Time is within the key range of an existing segment
+	SegmentMap::iterator iter = m_mapSegments.upper_bound(iKey);
+	if (iter != m_mapSegments.begin()) {
+		iter--;
+		Segment & seg = iter->second;
+
+		if (iKey <= seg.GetKeyEnd()) {
+			int64_t iOffset = iKey - seg.m_iKeyBegin;
+			if (iOffset == 0) {
+				return seg.m_sIxBegin;
+			}
+			if (iOffset % seg.m_iKeyStep == 0) {
+				return seg.m_sIxBegin + static_cast<size_t>(iOffset / seg.m_iKeyStep);
+			}
+
+			// Split the segment so key ranges do not overlap
+			size_t sSplit = static_cast<size_t>(iOffset / seg.m_iKeyStep) + 1;
+
+			Segment segSecond;
+			segSecond.m_timeBegin = GetSegmentTime(seg, sSplit);
+			segSecond.m_iKeyBegin =
+				seg.m_iKeyBegin + static_cast<int64_t>(sSplit) * seg.m_iKeyStep;
+			segSecond.m_iKeyStep = seg.m_iKeyStep;
+			segSecond.m_sCount = seg.m_sCount - sSplit;
+			segSecond.m_sIxBegin = seg.m_sIxBegin + sSplit;
+
+			seg.m_sCount = sSplit;
+			AddSegment(segSecond);
+		}
+	}
+
+	fInserted = true;
+
+	// Extend the segment holding the most recently inserted time.  Keys
+	// under CalendarNone are not unique, so those segments are not extended.
+	if ((m_mapIxToSegment.size() != 0) &&
+	    (time.GetCalendarType() != Time::CalendarNone)
+	) {
+		Segment & segLast = *(m_mapIxToSegment.rbegin()->second);
+
+		int64_t iKeyEnd = segLast.GetKeyEnd();
+		int64_t iStep = segLast.m_iKeyStep;
+		if (segLast.m_sCount == 1) {
+			iStep = iKey - iKeyEnd;
+		}
+
+		if ((iKey > iKeyEnd) && (iKey == iKeyEnd + iStep)) {
+			SegmentMap::const_iterator iterNext =
+				m_mapSegments.upper_bound(segLast.m_iKeyBegin);
+
+			if ((iterNext == m_mapSegments.end()) || (iterNext->first > iKey)) {
+				segLast.m_iKeyStep = iStep;
+				segLast.m_sCount++;
+				m_sCount++;
+				return (m_sCount - 1);
+			}
+		}
+	}
+
+	// Start a new segment
+	Segment seg;
+	seg.m_timeBegin = time;
+	seg.m_iKeyBegin = iKey;
+	seg.m_iKeyStep = 0;
+	seg.m_sCount = 1;
+	seg.m_sIxBegin = m_sCount;
+
+	AddSegment(seg);
+	m_sCount++;
+
+	return seg.m_sIxBegin;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool TimeAxis::Sort(
+	std::vector<IndexRun> & vecIndexRuns
+) {
+	vecIndexRuns.clear();
+
+	if (m_sCount == 0) {
+		return false;
+	}
+
+	// Segments are already in chronological order; renumber them
+	bool fReordered = false;
+
+	vecIndexRuns.resize(m_mapSegments.size());
+
+	size_t sIx = 0;
+	size_t sRun = 0;
+	SegmentMap::iterator iter = m_mapSegments.begin();
+	for (; iter != m_mapSegments.end(); iter++) {
+		Segment & seg = iter->second;
+		if (seg.m_sIxBegin != sIx) {
+			fReordered = true;
+		}
+
+		vecIndexRuns[sRun].m_sIxBegin = seg.m_sIxBegin;
+		vecIndexRuns[sRun].m_sNewIxBegin = sIx;
+		vecIndexRuns[sRun].m_sCount = seg.m_sCount;
+		sRun++;
+
+		seg.m_sIxBegin = sIx;
+		sIx += seg.m_sCount;
+	}
+
+	// Merge segments that continue one another
+	if (m_mapSegments.begin()->second.m_timeBegin.GetCalendarType()
+	    != Time::CalendarNone
+	) {
+		SegmentMap::iterator iterPrev = m_mapSegments.begin();
+		iter = iterPrev;
+		iter++;
+		while (iter != m_mapSegments.end()) {
+			Segment & segPrev = iterPrev->second;
+			const Segment & seg = iter->second;
+
+			int64_t iStep = segPrev.m_iKeyStep;
+			if (segPrev.m_sCount == 1) {
+				iStep = seg.m_iKeyBegin - segPrev.m_iKeyBegin;
+			}
+
+			if ((seg.m_iKeyBegin == segPrev.GetKeyEnd() + iStep) &&
+			    ((seg.m_sCount == 1) || (seg.m_iKeyStep == iStep))
+			) {
+				segPrev.m_iKeyStep = iStep;
+				segPrev.m_sCount += seg.m_sCount;
+				iter = m_mapSegments.erase(iter);
+
+			} else {
+				iterPrev = iter;
+				iter++;
+			}
+		}
+	}
+
+	RebuildIndexMap();
+
+	return fReordered;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool TimeAxis::operator==(const TimeAxis & axis) const {
+	if (m_sCount != axis.m_sCount) {
+		return false;
+	}
+	for (size_t t = 0; t < m_sCount; t++) {
+		if (GetTime(t) != axis.GetTime(t)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+Time TimeAxis::GetSegmentTime(
+	const Segment & seg,
+	size_t i
+) {
+	if (i == 0) {
+		return seg.m_timeBegin;
+	}
+
+	Time time(seg.m_timeBegin);
+	time.FromKey(seg.m_iKeyBegin + static_cast<int64_t>(i) * seg.m_iKeyStep);
+	return time;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+const TimeAxis::Segment * TimeAxis::FindSegment(
+	int64_t iKey
+) const {
+	SegmentMap::const_iterator iter = m_mapSegments.upper_bound(iKey);
+	if (iter == m_mapSegments.begin()) {
+		return NULL;
+	}
+	iter--;
+
+	if (iKey > iter->second.GetKeyEnd()) {
+		return NULL;
+	}
+	return &(iter->second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TimeAxis::AddSegment(
+	const Segment & seg
+) {
+	std::pair<SegmentMap::iterator, bool> prInsert =
+		m_mapSegments.insert(
+			SegmentMap::value_type(seg.m_iKeyBegin, seg));
+
+	if (!prInsert.second) {
+		_EXCEPTIONT("Logic error");
+	}
+
+	m_mapIxToSegment[seg.m_sIxBegin] = &(prInsert.first->second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TimeAxis::RebuildIndexMap() {
+	m_mapIxToSegment.clear();
+
+	SegmentMap::iterator iter = m_mapSegments.begin();
+	for (; iter != m_mapSegments.end(); iter++) {
+		m_mapIxToSegment[iter->second.m_sIxBegin] = &(iter->second);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
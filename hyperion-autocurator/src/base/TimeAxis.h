@@ -0,0 +1,251 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    TimeAxis.h
+///	\author  Paul Ullrich
+///	\version October 17, 2026
+///
+///	<remarks>
+///		Copyright 2016- Paul Ullrich
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _TIMEAXIS_H_
+#define _TIMEAXIS_H_
+
+#include "TimeObj.h"
+
+#include <map>
+#include <vector>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		An indexed set of distinct Times, all with the same calendar,
+///		stored as arithmetic segments (start, step, count) of Time keys.
+///		A regular time axis is a single segment no matter how many times
+///		it contains.  Times are indexed in the order they are inserted
+///		until Sort() is called.
+///	</summary>
+class TimeAxis {
+
+public:
+	///	<summary>
+	///		Invalid Time index.
+	///	</summary>
+	static const size_t InvalidTimeIx;
+
+public:
+	///	<summary>
+	///		A run of times with keys m_iKeyBegin + i * m_iKeyStep for
+	///		i in [0, m_sCount), with indices m_sIxBegin + i.
+	///	</summary>
+	class Segment {
+	public:
+		///	<summary>
+		///		Key of the last time in this segment.
+		///	</summary>
+		int64_t GetKeyEnd() const {
+			return m_iKeyBegin + static_cast<int64_t>(m_sCount - 1) * m_iKeyStep;
+		}
+
+	public:
+		///	<summary>
+		///		First time in this segment.
+		///	</summary>
+		Time m_timeBegin;
+
+		///	<summary>
+		///		Key of the first time in this segment.
+		///	</summary>
+		int64_t m_iKeyBegin;
+
+		///	<summary>
+		///		Difference in key between successive times (zero if the
+		///		segment contains a single time).
+		///	</summary>
+		int64_t m_iKeyStep;
+
+		///	<summary>
+		///		Number of times in this segment.
+		///	</summary>
+		size_t m_sCount;
+
+		///	<summary>
+		///		Index of the first time in this segment.
+		///	</summary>
+		size_t m_sIxBegin;
+	};
+
+	///	<summary>
+	///		A map from the first key in each segment to the segment.
+	///	</summary>
+	typedef std::map<int64_t, Segment> SegmentMap;
+
+	///	<summary>
+	///		A run of m_sCount consecutive time indices starting at
+	///		m_sIxBegin which Sort() moved to m_sNewIxBegin.
+	///	</summary>
+	class IndexRun {
+	public:
+		///	<summary>
+		///		First time index before sorting.
+		///	</summary>
+		size_t m_sIxBegin;
+
+		///	<summary>
+		///		First time index after sorting.
+		///	</summary>
+		size_t m_sNewIxBegin;
+
+		///	<summary>
+		///		Number of time indices in this run.
+		///	</summary>
+		size_t m_sCount;
+	};
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	TimeAxis() :
+		m_sCount(0)
+	{ }
+
+	///	<summary>
+	///		Copy constructor.
+	///	</summary>
+	TimeAxis(const TimeAxis & axis) {
+		(*this) = axis;
+	}
+
+	///	<summary>
+	///		Assignment operator.
+	///	</summary>
+	TimeAxis & operator=(const TimeAxis & axis);
+
+public:
+	///	<summary>
+	///		Remove all times.
+	///	</summary>
+	void Clear();
+
+	///	<summary>
+	///		Get the number of times.
+	///	</summary>
+	size_t GetCount() const {
+		return m_sCount;
+	}
+
+	///	<summary>
+	///		Get the number of segments.
+	///	</summary>
+	size_t GetSegmentCount() const {
+		return m_mapSegments.size();
+	}
+
+	///	<summary>
+	///		Get the segments, in chronological order.
+	///	</summary>
+	const SegmentMap & GetSegments() const {
+		return m_mapSegments;
+	}
+
+	///	<summary>
+	///		Get the Time with the given index.
+	///	</summary>
+	Time GetTime(size_t sTimeIx) const;
+
+	///	<summary>
+	///		Get the index of the given Time, or InvalidTimeIx.
+	///	</summary>
+	size_t Find(const Time & time) const;
+
+	///	<summary>
+	///		Get the index of the given Time, appending it with the next
+	///		index if it is not already present.  fInserted is set if the
+	///		Time was appended.
+	///	</summary>
+	size_t Insert(
+		const Time & time,
+		bool & fInserted
+	);
+
+	///	<summary>
+	///		Reindex the times in chronological order and merge segments
+	///		that continue one another.  Each segment is a run of indices
+	///		that keeps its order, so the permutation is returned as one
+	///		IndexRun per segment, ordered by new index.  Returns false if
+	///		no time changed index.
+	///	</summary>
+	bool Sort(
+		std::vector<IndexRun> & vecIndexRuns
+	);
+
+	///	<summary>
+	///		Equality operator.
+	///	</summary>
+	bool operator==(const TimeAxis & axis) const;
+
+	///	<summary>
+	///		Inequality operator.
+	///	</summary>
+	bool operator!=(const TimeAxis & axis) const {
+		return !((*this) == axis);
+	}
+
+protected:
+	///	<summary>
+	///		Get the Time at position i of a segment.
+	///	</summary>
+	static Time GetSegmentTime(
+		const Segment & seg,
+		size_t i
+	);
+
+	///	<summary>
+	///		Find the segment whose key range contains iKey, or NULL.
+	///	</summary>
+	const Segment * FindSegment(
+		int64_t iKey
+	) const;
+
+	///	<summary>
+	///		Add a segment to both maps.
+	///	</summary>
+	void AddSegment(
+		const Segment & seg
+	);
+
+	///	<summary>
+	///		Rebuild m_mapIxToSegment from m_mapSegments.
+	///	</summary>
+	void RebuildIndexMap();
+
+protected:
+	///	<summary>
+	///		Number of times.
+	///	</summary>
+	size_t m_sCount;
+
+	///	<summary>
+	///		Segments, keyed on their first key.  The key ranges of the
+	///		segments do not overlap.
+	///	</summary>
+	SegmentMap m_mapSegments;
+
+	///	<summary>
+	///		A map from the first index in each segment to the segment.
+	///	</summary>
+	std::map<size_t, Segment *> m_mapIxToSegment;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -22,6 +22,27 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Integer division rounded towards negative infinity.
+///	</summary>
+template <typename T>
+static inline T FloorDivide(T a, T b) {
+	T q = a / b;
+	if ((a % b != 0) && ((a < 0) != (b < 0))) {
+		q--;
+	}
+	return q;
+}
+
+///	<summary>
+///		Check if the given year is a leap year in the standard calendar.
+///	</summary>
+static inline bool IsLeapYear(int iYear) {
+	return ((iYear % 4) == 0) && (((iYear % 100) != 0) || ((iYear % 400) == 0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 bool Time::operator==(const Time & time) const {
 	if ((m_eCalendarType != time.m_eCalendarType) ||
 	    (m_eTimeType     != time.m_eTimeType)     ||
@@ -184,16 +205,6 @@ void Time::NormalizeTime() {
 		int nDaysPerMonth[]
 			= {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
 
-		if ((m_eCalendarType == CalendarStandard) ||
-			(m_eCalendarType == CalendarGregorian)
-		) {
-			if ((m_iYear % 4) == 0) {
-				nDaysPerMonth[1] = 29;
-				if (((m_iYear % 100) == 0) && ((m_iYear % 400) != 0)) {
-					nDaysPerMonth[1] = 28;
-				}
-			}
-		}
 		if (m_eCalendarType == Calendar360Day) {
 			for (int i = 0; i < 12; i++) {
 				nDaysPerMonth[i] = 30;
@@ -237,49 +248,21 @@ void Time::NormalizeTime() {
 			_EXCEPTIONT("Logic error");
 		}
 
-		// Subtract months
-		while (m_iDay < 0) {
-			m_iMonth--;
-			if (m_iMonth < 0) {
-				m_iMonth = 11;
-				m_iYear--;
-
-				// Adjust number of days per month
-				if ((m_eCalendarType == CalendarStandard) ||
-					(m_eCalendarType == CalendarGregorian)
-				) {
-					nDaysPerMonth[1] = 28;
-					if ((m_iYear % 4) == 0) {
-						nDaysPerMonth[1] = 29;
-						if (((m_iYear % 100) == 0) && ((m_iYear % 400) != 0)) {
-							nDaysPerMonth[1] = 28;
-						}
-					}
-				}
-			}
-			m_iDay += nDaysPerMonth[m_iMonth];
+		// Length of February in the current year
+		if ((m_eCalendarType == CalendarStandard) ||
+			(m_eCalendarType == CalendarGregorian)
+		) {
+			nDaysPerMonth[1] = IsLeapYear(m_iYear)?(29):(28);
 		}
 
-		// Add months
-		while (m_iDay >= nDaysPerMonth[m_iMonth]) {
-			m_iDay -= nDaysPerMonth[m_iMonth];
-			m_iMonth++;
-			if (m_iMonth > 11) {
-				m_iMonth = 0;
-				m_iYear++;
-
-				// Adjust number of days per month
-				if ((m_eCalendarType == CalendarStandard) ||
-					(m_eCalendarType == CalendarGregorian)
-				) {
-					nDaysPerMonth[1] = 28;
-					if ((m_iYear % 4) == 0) {
-						nDaysPerMonth[1] = 29;
-						if (((m_iYear % 100) == 0) && ((m_iYear % 400) != 0)) {
-							nDaysPerMonth[1] = 28;
-						}
-					}
-				}
+		// Carry days into months and years through the day number
+		if ((m_iDay < 0) || (m_iDay >= nDaysPerMonth[m_iMonth])) {
+			FromDayNumber(DayNumber());
+
+			if ((m_eCalendarType == CalendarStandard) ||
+				(m_eCalendarType == CalendarGregorian)
+			) {
+				nDaysPerMonth[1] = IsLeapYear(m_iYear)?(29):(28);
 			}
 		}
 
@@ -317,7 +300,8 @@ void Time::AddTime(const Time & timeDelta) {
 int Time::DayNumber() const {
 
 	// Based on https://alcor.concordia.ca/~gpkatch/gdate-algorithm.html
-	// but modified since m_iMonth and m_iDay are zero-indexed
+	// but modified since m_iMonth and m_iDay are zero-indexed, and with
+	// floor division so that years before 1 are counted correctly
 	if (m_eCalendarType == CalendarNoLeap) {
 		int nM = (m_iMonth + 10) % 12;
 		int nY = m_iYear - nM/10;
@@ -331,7 +315,8 @@ int Time::DayNumber() const {
 	) {
 		int nM = (m_iMonth + 10) % 12;
 		int nY = m_iYear - nM/10;
-		int nDay = 365 * nY + nY / 4 - nY / 100 + nY / 400
+		int nDay = 365 * nY
+			+ FloorDivide(nY, 4) - FloorDivide(nY, 100) + FloorDivide(nY, 400)
 			+ (nM * 306 + 5) / 10 + m_iDay;
 
 		return nDay;
@@ -346,6 +331,90 @@ int Time::DayNumber() const {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void Time::FromDayNumber(int nDayNumber) {
+
+	// Inverse of DayNumber(); years in the day number start on March 1
+	if (m_eCalendarType == CalendarNoLeap) {
+		int nY = FloorDivide(nDayNumber, 365);
+		int nDayOfYear = nDayNumber - 365 * nY;
+		int nM = (100 * nDayOfYear + 52) / 3060;
+
+		m_iYear = nY + (nM + 2) / 12;
+		m_iMonth = (nM + 2) % 12;
+		m_iDay = nDayOfYear - (nM * 306 + 5) / 10;
+
+	} else if (
+		(m_eCalendarType == CalendarStandard) ||
+		(m_eCalendarType == CalendarGregorian)
+	) {
+		long long llDayNumber = static_cast<long long>(nDayNumber);
+		int nY = static_cast<int>(
+			FloorDivide(10000LL * llDayNumber + 14780LL, 3652425LL));
+
+		int nDayOfYear = nDayNumber
+			- (365 * nY + FloorDivide(nY, 4)
+				- FloorDivide(nY, 100) + FloorDivide(nY, 400));
+		if (nDayOfYear < 0) {
+			nY--;
+			nDayOfYear = nDayNumber
+				- (365 * nY + FloorDivide(nY, 4)
+					- FloorDivide(nY, 100) + FloorDivide(nY, 400));
+		}
+		int nM = (100 * nDayOfYear + 52) / 3060;
+
+		m_iYear = nY + (nM + 2) / 12;
+		m_iMonth = (nM + 2) % 12;
+		m_iDay = nDayOfYear - (nM * 306 + 5) / 10;
+
+	} else if (m_eCalendarType == Calendar360Day) {
+		m_iYear = FloorDivide(nDayNumber, 360);
+		int nDayOfYear = nDayNumber - 360 * m_iYear;
+		m_iMonth = nDayOfYear / 30;
+		m_iDay = nDayOfYear % 30;
+
+	} else {
+		_EXCEPTIONT("Not implemented");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int64_t Time::GetKey() const {
+	int64_t iDays;
+	if (m_eCalendarType == CalendarNone) {
+		iDays =
+			360 * static_cast<int64_t>(m_iYear)
+			+ 30 * static_cast<int64_t>(m_iMonth)
+			+ static_cast<int64_t>(m_iDay);
+	} else {
+		iDays = static_cast<int64_t>(DayNumber());
+	}
+
+	return (iDays * 86400 + static_cast<int64_t>(m_iSecond)) * 1000000
+		+ static_cast<int64_t>(m_iMicroSecond);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Time::FromKey(int64_t iKey) {
+	int64_t iDays = FloorDivide(iKey, static_cast<int64_t>(86400000000LL));
+	int64_t iMicroSecondOfDay = iKey - iDays * 86400000000LL;
+
+	m_iSecond = static_cast<int>(iMicroSecondOfDay / 1000000);
+	m_iMicroSecond = static_cast<int>(iMicroSecondOfDay % 1000000);
+
+	if (m_eCalendarType == CalendarNone) {
+		m_iYear = static_cast<int>(FloorDivide(iDays, static_cast<int64_t>(360)));
+		int nDayOfYear = static_cast<int>(iDays - 360 * static_cast<int64_t>(m_iYear));
+		m_iMonth = nDayOfYear / 30;
+		m_iDay = nDayOfYear % 30;
+	} else {
+		FromDayNumber(static_cast<int>(iDays));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 double Time::operator-(const Time & time) const {
 	return -DeltaSeconds(time);
 }
@@ -934,6 +1003,137 @@ void Time::FromCFCompliantUnitsOffsetDouble(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Units of a CF-compliant time unit string.
+///	</summary>
+enum CFTimeUnits {
+	CFTimeUnitsUnknown,
+	CFTimeUnitsMonths,
+	CFTimeUnitsDays,
+	CFTimeUnitsHours,
+	CFTimeUnitsMinutes
+};
+
+///	<summary>
+///		Get the units of a CF-compliant time unit string and the position
+///		of the reference time within the string.
+///	</summary>
+static CFTimeUnits GetCFTimeUnits(
+	const std::string & strFormattedTime,
+	size_t & sReferencePos
+) {
+	static const struct {
+		const char * szPrefix;
+		size_t sLength;
+		CFTimeUnits eUnits;
+	} CFTimeUnitPrefixes[] = {
+		{"months since ", 13, CFTimeUnitsMonths},
+		{"days since ", 11, CFTimeUnitsDays},
+		{"hours since ", 12, CFTimeUnitsHours},
+		{"minutes since ", 14, CFTimeUnitsMinutes}
+	};
+
+	for (size_t i = 0; i < 4; i++) {
+		if ((strFormattedTime.length() >= CFTimeUnitPrefixes[i].sLength) &&
+		    (strncmp(
+				strFormattedTime.c_str(),
+				CFTimeUnitPrefixes[i].szPrefix,
+				CFTimeUnitPrefixes[i].sLength) == 0)
+		) {
+			sReferencePos = CFTimeUnitPrefixes[i].sLength;
+			return CFTimeUnitPrefixes[i].eUnits;
+		}
+	}
+	return CFTimeUnitsUnknown;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Time::FromCFCompliantUnitsOffsets(
+	const std::string & strFormattedTime,
+	CalendarType eCalendarType,
+	const std::vector<int> & vecOffsets,
+	std::vector<Time> & vecTimes
+) {
+	vecTimes.clear();
+	if (vecOffsets.size() == 0) {
+		return;
+	}
+
+	// Integer offsets do not support "months since ..."
+	size_t sReferencePos;
+	CFTimeUnits eUnits = GetCFTimeUnits(strFormattedTime, sReferencePos);
+	if ((eUnits == CFTimeUnitsUnknown) || (eUnits == CFTimeUnitsMonths)) {
+		_EXCEPTIONT("Unknown \"time::units\" format");
+	}
+
+	// Parse the reference time once
+	Time timeReference(eCalendarType);
+	timeReference.FromFormattedString(strFormattedTime.substr(sReferencePos));
+
+	vecTimes.resize(vecOffsets.size(), timeReference);
+	for (size_t i = 0; i < vecOffsets.size(); i++) {
+		if (eUnits == CFTimeUnitsDays) {
+			vecTimes[i].AddDays(vecOffsets[i]);
+		} else if (eUnits == CFTimeUnitsHours) {
+			vecTimes[i].AddHours(vecOffsets[i]);
+		} else {
+			vecTimes[i].AddMinutes(vecOffsets[i]);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Time::FromCFCompliantUnitsOffsets(
+	const std::string & strFormattedTime,
+	CalendarType eCalendarType,
+	const std::vector<double> & vecOffsets,
+	std::vector<Time> & vecTimes
+) {
+	vecTimes.clear();
+	if (vecOffsets.size() == 0) {
+		return;
+	}
+
+	size_t sReferencePos;
+	CFTimeUnits eUnits = GetCFTimeUnits(strFormattedTime, sReferencePos);
+	if (eUnits == CFTimeUnitsUnknown) {
+		_EXCEPTIONT("Unknown \"time::units\" format");
+	}
+
+	// Parse the reference time once
+	Time timeReference(eCalendarType);
+	timeReference.FromFormattedString(strFormattedTime.substr(sReferencePos));
+
+	vecTimes.resize(vecOffsets.size(), timeReference);
+	for (size_t i = 0; i < vecOffsets.size(); i++) {
+		const double dOffset = vecOffsets[i];
+		Time & time = vecTimes[i];
+
+		if (eUnits == CFTimeUnitsMonths) {
+			time.AddMonths(static_cast<int>(dOffset));
+			if (fmod(dOffset, 1.0) > 1.0e-14) {
+				_EXCEPTIONT("Only integer values accepted for time in format \"months since ...\"");
+			}
+
+		} else if (eUnits == CFTimeUnitsDays) {
+			time.AddDays(static_cast<int>(dOffset));
+			time.AddSeconds(static_cast<int>(fmod(dOffset, 1.0) * 86400.0));
+
+		} else if (eUnits == CFTimeUnitsHours) {
+			time.AddHours(static_cast<int>(dOffset));
+			time.AddSeconds(static_cast<int>(fmod(dOffset, 1.0) * 3600.0));
+
+		} else {
+			time.AddMinutes(static_cast<int>(dOffset));
+			time.AddSeconds(static_cast<int>(fmod(dOffset, 1.0) * 60.0));
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 double Time::GetCFCompliantUnitsOffsetDouble(
 	const std::string & strFormattedTime
 ) {
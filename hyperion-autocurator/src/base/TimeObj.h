@@ -21,8 +21,10 @@
 #include "STLStringHelper.h"
 
 #include <string>
+#include <vector>
 #include <cstdlib>
 #include <cmath>
+#include <cstdint>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -302,6 +304,27 @@ public:
 	///	</summary>
 	int DayNumber() const;
 
+	///	<summary>
+	///		Set the date from a day number, as returned by DayNumber().
+	///		The time of day is unchanged.
+	///	</summary>
+	void FromDayNumber(int nDayNumber);
+
+	///	<summary>
+	///		Get a 64-bit key for this Time, in microseconds since day
+	///		number zero.  For normalized calendars two Times have the same
+	///		key if and only if they are equal, and keys are ordered the
+	///		same way as Times.  Under CalendarNone months are counted as
+	///		30 days, since these Times are not normalized.
+	///	</summary>
+	int64_t GetKey() const;
+
+	///	<summary>
+	///		Set this Time from a key, as returned by GetKey().  The
+	///		calendar and TimeType are unchanged.
+	///	</summary>
+	void FromKey(int64_t iKey);
+
 	///	<summary>
 	///		Determine the number of seconds between two Times.
 	///	</summary>
@@ -511,6 +534,32 @@ public:
 		double dOffset
 	);
 
+	///	<summary>
+	///		Decode an array of integer offsets in a CF-compliant time unit
+	///		string.  The reference time is parsed once and each element of
+	///		vecTimes is equal to FromCFCompliantUnitsOffsetInt() applied
+	///		to the corresponding offset.
+	///	</summary>
+	static void FromCFCompliantUnitsOffsets(
+		const std::string & strFormattedTime,
+		CalendarType eCalendarType,
+		const std::vector<int> & vecOffsets,
+		std::vector<Time> & vecTimes
+	);
+
+	///	<summary>
+	///		Decode an array of floating point offsets in a CF-compliant time
+	///		unit string.  The reference time is parsed once and each element
+	///		of vecTimes is equal to FromCFCompliantUnitsOffsetDouble()
+	///		applied to the corresponding offset.
+	///	</summary>
+	static void FromCFCompliantUnitsOffsets(
+		const std::string & strFormattedTime,
+		CalendarType eCalendarType,
+		const std::vector<double> & vecOffsets,
+		std::vector<Time> & vecTimes
+	);
+
 	///	<summary>
 	///		Get the Time using a CF-compliant time unit string.
 	///		- "hours since ..."